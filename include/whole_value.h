@@ -107,6 +107,12 @@
 # endif
 #endif
 
+#if ( __cplusplus >= 201103L ) || ( defined( _MSC_VER ) && ( _MSC_VER >= 1900 ) )
+# define G_WV_CONSTEXPR constexpr
+#else
+# define G_WV_CONSTEXPR
+#endif
+
 #if defined( WV_ALLOW_CONVERSION_FROM_UNDERLYING_TYPE )
 # define WV_ALLOW_CONVERSION_FROM_UNDERLYING_TYPE_FOR_VALUE
 # define WV_ALLOW_CONVERSION_FROM_UNDERLYING_TYPE_FOR_BITS
@@ -508,11 +514,11 @@ class quantity
 public:
     typedef T value_type;
 
-    quantity() : m_value( value_type() ) {}
+    G_WV_CONSTEXPR quantity() : m_value( value_type() ) {}
 
-    WV_EXPLICIT_QUANTITY quantity( value_type const value ) : m_value( value ) {}
+    WV_EXPLICIT_QUANTITY G_WV_CONSTEXPR quantity( value_type const value ) : m_value( value ) {}
 
-    quantity( quantity const & other ) : m_value( other.m_value ) {}
+    G_WV_CONSTEXPR quantity( quantity const & other ) : m_value( other.m_value ) {}
 
 #ifdef G_WV_COMPILER_IS_MSVC6
     quantity & operator=( quantity const & other )
@@ -538,7 +544,7 @@ public:
      * Conversion to underlying type is needed so that operations can be added
      * as freestanding functions/operators.
      */
-    value_type value() const { return m_value; }
+    G_WV_CONSTEXPR value_type value() const { return m_value; }
 
 #ifdef G_WV_COMPILER_IS_MSVC6
     template<typename U>
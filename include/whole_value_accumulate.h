@@ -0,0 +1,182 @@
+/*
+ * whole_value_accumulate.h
+ * widening accumulators, and sum and mean kernels that use them.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * wider<T> names the accumulator of underlying type T: int64_t for narrower
+ * signed integers, uint64_t for narrower unsigned integers, double for
+ * float, T itself otherwise. Specialize it to change, e.g. to accumulate
+ * double in long double.
+ *
+ * accumulator<Q>::type is the same template as Q with the same tag and the
+ * wider underlying type: quantity<int32_t, Volume_tag> accumulates in
+ * quantity<int64_t, Volume_tag>. accumulator<Q>::mean_type has a floating
+ * point underlying type. Sub types map to their base type's accumulator.
+ *
+ * sum() and mean() read the narrow values and add them as wide ones, in
+ * eight independent lanes; widen() and narrow() convert whole spans. These
+ * loops are written for the compiler to vectorize (a sign extension plus
+ * add, e.g. vpmovsxdq and vpaddq on AVX2), so a column keeps the memory
+ * footprint of its narrow type. Floating point sums are added in eight
+ * lanes, so the rounding differs from a sequential loop.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_ACCUMULATE_H_INCLUDED
+#define G_WV_WHOLE_VALUE_ACCUMULATE_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+
+namespace wv {
+
+/**
+ * accumulator type for underlying type T.
+ */
+template< typename T, typename Enable = void >
+struct wider
+{
+    typedef T type;
+};
+
+template< typename T >
+struct wider< T, typename std::enable_if< std::is_integral<T>::value && std::is_signed<T>::value && ( sizeof( T ) < 8 ) >::type >
+{
+    typedef int64_t type;
+};
+
+template< typename T >
+struct wider< T, typename std::enable_if< std::is_integral<T>::value && !std::is_signed<T>::value && ( sizeof( T ) < 8 ) >::type >
+{
+    typedef uint64_t type;
+};
+
+template<>
+struct wider< float >
+{
+    typedef double type;
+};
+
+namespace detail {
+
+    template< typename T >
+    struct real_of
+    {
+        typedef typename wider<T>::type W;
+        typedef typename std::conditional< std::is_floating_point<W>::value, W, double >::type type;
+    };
+
+    template< typename T, typename TG > arithmetic< typename wider<T>::type, TG > accumulator_of( arithmetic<T,TG> const * );
+    template< typename T, typename TG > quantity  < typename wider<T>::type, TG > accumulator_of( quantity<T,TG> const * );
+
+    template< typename T, typename TG > arithmetic< typename real_of<T>::type, TG > mean_of( arithmetic<T,TG> const * );
+    template< typename T, typename TG > quantity  < typename real_of<T>::type, TG > mean_of( quantity<T,TG> const * );
+
+} // namespace detail
+
+/**
+ * wide accumulator and mean types of arithmetic or quantity type Q.
+ */
+template< typename Q >
+struct accumulator
+{
+    typedef decltype( detail::accumulator_of( static_cast<Q const *>( 0 ) ) ) type;
+    typedef decltype( detail::mean_of( static_cast<Q const *>( 0 ) ) ) mean_type;
+};
+
+/**
+ * sum of a in the accumulator type.
+ */
+template< typename Q >
+typename accumulator< typename std::remove_const<Q>::type >::type sum( span<Q> const a )
+{
+    typedef typename std::remove_const<Q>::type V;
+    typedef typename accumulator<V>::type R;
+    typedef typename R::value_type W;
+
+    typename V::value_type const * const p = values( span<V const>( a ) ).data();
+    std::size_t const n = a.size();
+
+    W s[8] = {};
+
+    std::size_t i = 0;
+    for ( ; i + 8 <= n; i += 8 )
+        for ( unsigned lane = 0; lane < 8; ++lane )
+            s[lane] += W( p[ i + lane ] );
+
+    for ( ; i < n; ++i )
+        s[0] += W( p[i] );
+
+    return R( ( ( s[0] + s[1] ) + ( s[2] + s[3] ) ) + ( ( s[4] + s[5] ) + ( s[6] + s[7] ) ) );
+}
+
+/**
+ * arithmetic mean of a in the mean type; zero for an empty span.
+ */
+template< typename Q >
+typename accumulator< typename std::remove_const<Q>::type >::mean_type mean( span<Q> const a )
+{
+    typedef typename accumulator< typename std::remove_const<Q>::type >::mean_type R;
+    typedef typename R::value_type T;
+
+    return a.empty() ? R() : R( T( sum( a ).value() ) / T( a.size() ) );
+}
+
+/**
+ * out[i] = in[i] in the accumulator type.
+ */
+template< typename Q >
+void widen( span<Q> const in, span< typename accumulator< typename std::remove_const<Q>::type >::type > const out )
+{
+    typedef typename std::remove_const<Q>::type V;
+    typedef typename accumulator<V>::type R;
+    typedef typename R::value_type W;
+
+    assert( in.size() == out.size() && "widen: different sizes" );
+
+    typename V::value_type const * const p = values( span<V const>( in ) ).data();
+    W * const q = values( out ).data();
+
+    for ( std::size_t i = 0; i < in.size(); ++i )
+        q[i] = W( p[i] );
+}
+
+/**
+ * out[i] = in[i] converted back to the narrow type; the values must fit.
+ */
+template< typename R, typename Q >
+void narrow( span<R> const in, span<Q> const out )
+{
+    typedef typename std::remove_const<R>::type W;
+    typedef typename Q::value_type T;
+
+    static_assert( std::is_same< W, typename accumulator<Q>::type >::value, "narrow: in must hold the accumulator type of out" );
+    assert( in.size() == out.size() && "narrow: different sizes" );
+
+    typename W::value_type const * const p = values( span<W const>( in ) ).data();
+    T * const q = values( out ).data();
+
+    for ( std::size_t i = 0; i < in.size(); ++i )
+        q[i] = T( p[i] );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_ACCUMULATE_H_INCLUDED
+
+/*
+ * end of file
+ */
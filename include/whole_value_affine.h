@@ -0,0 +1,120 @@
+/*
+ * whole_value_affine.h
+ * affine point type paired with a quantity: timestamps and durations.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * point<V, TG> is a position in the affine space of its vector type V, a
+ * quantity (or arithmetic) type: a timestamp for a duration, a position for
+ * an offset, an address for a byte count. Only the affine operations exist:
+ *
+ *   point - point  -> V
+ *   point + V, V + point, point - V  -> point
+ *
+ * and comparison; point + point, point * n and the like do not compile.
+ * A point holds a single value_type and has no user-declared copy
+ * operations, so it is passed and returned in a register like the raw
+ * value, and loops over points compile to the code for raw integers.
+ *
+ * Use WV_DEFINE_POINT_TYPE() to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_AFFINE_H_INCLUDED
+#define G_WV_WHOLE_VALUE_AFFINE_H_INCLUDED
+
+#include "whole_value.h"
+
+#include <utility>
+
+/**
+ * create point type with vector type vector_type.
+ */
+#define WV_DEFINE_POINT_TYPE( type_name, vector_type ) \
+    struct type_name##_tag{}; \
+    typedef ::wv::point<vector_type, type_name##_tag> type_name;
+
+namespace wv {
+
+/**
+ * point in the affine space of vector type V.
+ */
+template< typename V, typename TG >
+class point
+{
+public:
+    typedef typename V::value_type value_type;
+    typedef V vector_type;
+
+    constexpr point() : m_value( value_type() ) {}
+
+    constexpr explicit point( value_type const value ) : m_value( value ) {}
+
+    /**
+     * the point at offset from the origin, the point with value 0.
+     */
+    static constexpr point from_origin( vector_type const & offset ) { return point( offset.value() ); }
+
+    constexpr value_type value() const { return m_value; }
+
+    /**
+     * the offset from the origin.
+     */
+    constexpr vector_type since_origin() const { return vector_type( m_value ); }
+
+    friend void swap( point & first, point & second )
+    {
+        using std::swap;
+        swap( first.m_value, second.m_value );
+    }
+
+    friend bool operator==( point const & x, point const & y ) { return x.m_value == y.m_value; }
+    friend bool operator!=( point const & x, point const & y ) { return x.m_value != y.m_value; }
+    friend bool operator< ( point const & x, point const & y ) { return x.m_value <  y.m_value; }
+    friend bool operator> ( point const & x, point const & y ) { return x.m_value >  y.m_value; }
+    friend bool operator<=( point const & x, point const & y ) { return x.m_value <= y.m_value; }
+    friend bool operator>=( point const & x, point const & y ) { return x.m_value >= y.m_value; }
+
+    point & operator+=( vector_type const & v )
+    {
+        m_value += v.value();
+        return *this;
+    }
+
+    point & operator-=( vector_type const & v )
+    {
+        m_value -= v.value();
+        return *this;
+    }
+
+    friend point operator+( point const & x, vector_type const & v ) { return point( x.m_value + v.value() ); }
+    friend point operator+( vector_type const & v, point const & x ) { return point( v.value() + x.m_value ); }
+    friend point operator-( point const & x, vector_type const & v ) { return point( x.m_value - v.value() ); }
+
+    friend vector_type operator-( point const & x, point const & y ) { return vector_type( x.m_value - y.m_value ); }
+
+private:
+    value_type m_value;
+};
+
+/**
+ * value as underlying type, integer (long) and real (double).
+ */
+template< typename V, typename TG > inline typename V::value_type to_value( point<V,TG> const & x ) { return x.value(); }
+template< typename V, typename TG > inline long to_integer( point<V,TG> const & x ) { return long( x.value() ); }
+template< typename V, typename TG > inline double to_real( point<V,TG> const & x ) { return double( x.value() ); }
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_AFFINE_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,312 @@
+/*
+ * whole_value_bounded.h
+ * integral whole values within a compile-time range.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * bounded<Q, Min, Max, Policy> is a whole value Q of integral underlying type
+ * known to lie in [Min, Max]. Construction from a Q checks the range once
+ * and reports a value outside it to Policy::overflow() of
+ * whole_value_checked.h (throw_on_overflow by default); when the policy
+ * returns, the value is clamped to the range.
+ *
+ * Operations on bounded values compute the bounds of their result at
+ * compile time, and need no check:
+ *
+ *   bounded<Q, 0, 100> + bounded<Q, 0, 100>  -> bounded<Q, 0, 200>
+ *   bounded<Q, 0, 100> - bounded<Q, 0, 100>  -> bounded<Q, -100, 100>
+ *
+ * and * and / likewise where Q * Q and Q / Q give Q (arithmetic, not
+ * quantity), / only for a divisor range without zero. A bounded value
+ * converts implicitly to a bounded type whose range contains its own;
+ * bounded_cast<>() converts to a narrower one and checks only the bounds
+ * that can be exceeded: a bound that is implied by the source range costs
+ * nothing. A result range that Q's underlying type cannot hold does not
+ * compile.
+ *
+ * The value is stored in the smallest integer type that holds [Min, Max]:
+ * bounded<Q, 0, 100> takes one byte and bounded<Q, 0, 65535> two, whatever
+ * Q's underlying type.
+ *
+ * Use WV_DEFINE_BOUNDED_TYPE() to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_BOUNDED_H_INCLUDED
+#define G_WV_WHOLE_VALUE_BOUNDED_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_checked.h"
+
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+/**
+ * create bounded type of whole value type with range [min_value, max_value].
+ */
+#define WV_DEFINE_BOUNDED_TYPE( type_name, whole_value_type, min_value, max_value ) \
+    typedef ::wv::bounded<whole_value_type, min_value, max_value> type_name;
+
+namespace wv {
+
+template< typename Q, intmax_t Min, intmax_t Max, typename Policy = throw_on_overflow >
+class bounded;
+
+namespace detail {
+
+    /**
+     * integral type T holds [Lo, Hi].
+     */
+    template< typename T, intmax_t Lo, intmax_t Hi >
+    struct bounded_fits
+    {
+        static const bool value =
+            ( Lo >= 0 || ( std::is_signed<T>::value && Lo >= intmax_t( std::numeric_limits<T>::min() ) ) ) &&
+            ( Hi < 0 || uintmax_t( Hi ) <= uintmax_t( std::numeric_limits<T>::max() ) );
+    };
+
+    /**
+     * range of integral type T, within that of intmax_t.
+     */
+    template< typename T >
+    struct bounded_limits
+    {
+        static const intmax_t lo = intmax_t( std::numeric_limits<T>::min() );
+        static const intmax_t hi = uintmax_t( std::numeric_limits<T>::max() ) < uintmax_t( std::numeric_limits<intmax_t>::max() ) ?
+            intmax_t( std::numeric_limits<T>::max() ) : std::numeric_limits<intmax_t>::max();
+    };
+
+    /**
+     * smallest integer type that holds [Lo, Hi].
+     */
+    template< intmax_t Lo, intmax_t Hi >
+    struct bounded_storage
+    {
+        typedef typename std::conditional< ( Lo >= 0 ),
+            typename std::conditional< bounded_fits<uint8_t , Lo, Hi>::value, uint8_t ,
+            typename std::conditional< bounded_fits<uint16_t, Lo, Hi>::value, uint16_t,
+            typename std::conditional< bounded_fits<uint32_t, Lo, Hi>::value, uint32_t, uint64_t >::type >::type >::type,
+            typename std::conditional< bounded_fits<int8_t  , Lo, Hi>::value, int8_t  ,
+            typename std::conditional< bounded_fits<int16_t , Lo, Hi>::value, int16_t ,
+            typename std::conditional< bounded_fits<int32_t , Lo, Hi>::value, int32_t , int64_t >::type >::type >::type >::type type;
+    };
+
+    constexpr intmax_t bounded_min( intmax_t const a, intmax_t const b ) { return a < b ? a : b; }
+    constexpr intmax_t bounded_max( intmax_t const a, intmax_t const b ) { return a < b ? b : a; }
+
+    /**
+     * bounds of the products and quotients of [A, B] and [C, D]: the extremes
+     * of the corners.
+     */
+    template< intmax_t A, intmax_t B, intmax_t C, intmax_t D >
+    struct bounded_multiply
+    {
+        static const intmax_t lo = bounded_min( bounded_min( A * C, A * D ), bounded_min( B * C, B * D ) );
+        static const intmax_t hi = bounded_max( bounded_max( A * C, A * D ), bounded_max( B * C, B * D ) );
+    };
+
+    template< intmax_t A, intmax_t B, intmax_t C, intmax_t D >
+    struct bounded_divide
+    {
+        static const intmax_t lo = bounded_min( bounded_min( A / C, A / D ), bounded_min( B / C, B / D ) );
+        static const intmax_t hi = bounded_max( bounded_max( A / C, A / D ), bounded_max( B / C, B / D ) );
+    };
+
+    /**
+     * x in [Lo, Hi] from x in [L, U]: only the bounds the source range
+     * does not imply are tested.
+     */
+    template< typename Policy, intmax_t Lo, intmax_t Hi, intmax_t L, intmax_t U, typename T >
+    T bounded_check( T const x )
+    {
+        static const bool test_lo = L < Lo;
+        static const bool test_hi = U > Hi;
+
+        if ( G_WV_UNLIKELY( test_lo && x < T( Lo ) ) )
+        {
+            Policy::overflow( "bounded: value below range" );
+            return T( Lo );
+        }
+        if ( G_WV_UNLIKELY( test_hi && x > T( Hi ) ) )
+        {
+            Policy::overflow( "bounded: value above range" );
+            return T( Hi );
+        }
+        return x;
+    }
+
+    /**
+     * the result of an operation, in range by construction.
+     */
+    struct bounded_unchecked {};
+
+} // namespace detail
+
+/**
+ * whole value Q within [Min, Max].
+ */
+template< typename Q, intmax_t Min, intmax_t Max, typename Policy >
+class bounded
+{
+public:
+    typedef typename Q::value_type value_type;
+    typedef typename detail::bounded_storage<Min, Max>::type storage_type;
+    typedef Q whole_value_type;
+    typedef Policy policy_type;
+
+    static_assert( std::is_integral<value_type>::value, "bounded types need an integral underlying type" );
+    static_assert( Min <= Max, "bounded: empty range" );
+    static_assert( detail::bounded_fits<value_type, Min, Max>::value, "bounded: range does not fit the underlying type" );
+
+    static const intmax_t lower = Min;
+    static const intmax_t upper = Max;
+
+    /**
+     * 0, or the bound nearest to 0 where 0 is out of range.
+     */
+    constexpr bounded() : m_value( storage_type( Min > 0 ? Min : Max < 0 ? Max : 0 ) ) {}
+
+    /**
+     * x, checked against the range.
+     */
+    explicit bounded( Q const & x )
+    : m_value( storage_type( detail::bounded_check< Policy, Min, Max,
+        detail::bounded_limits<value_type>::lo, detail::bounded_limits<value_type>::hi >( x.value() ) ) ) {}
+
+    /**
+     * from a bounded value with a range within this one.
+     */
+    template< intmax_t L, intmax_t U, typename P, typename = typename std::enable_if< ( L >= Min && U <= Max ) >::type >
+    constexpr bounded( bounded<Q, L, U, P> const & other ) : m_value( storage_type( other.raw() ) ) {}
+
+    /**
+     * x, known to be in range.
+     */
+    constexpr bounded( detail::bounded_unchecked, value_type const x ) : m_value( storage_type( x ) ) {}
+
+    /**
+     * x is within [Min, Max].
+     */
+    static bool contains( Q const & x )
+    {
+        return !( x.value() < value_type( Min ) ) && !( value_type( Max ) < x.value() );
+    }
+
+    constexpr Q value() const { return Q( value_type( m_value ) ); }
+
+    /**
+     * the value as underlying type.
+     */
+    constexpr value_type raw() const { return value_type( m_value ); }
+
+    friend void swap( bounded & first, bounded & second )
+    {
+        using std::swap;
+        swap( first.m_value, second.m_value );
+    }
+
+private:
+    storage_type m_value;
+};
+
+template< typename Q, intmax_t Min, intmax_t Max, typename Policy >
+const intmax_t bounded<Q, Min, Max, Policy>::lower;
+
+template< typename Q, intmax_t Min, intmax_t Max, typename Policy >
+const intmax_t bounded<Q, Min, Max, Policy>::upper;
+
+/**
+ * x in the range of To, checking the bounds of To that the range of x does not imply.
+ */
+template< typename To, typename Q, intmax_t L, intmax_t U, typename P >
+inline To bounded_cast( bounded<Q, L, U, P> const & x )
+{
+    static_assert( std::is_same< typename To::whole_value_type, Q >::value, "bounded_cast: different whole value types" );
+
+    return To( detail::bounded_unchecked(), detail::bounded_check< typename To::policy_type, To::lower, To::upper, L, U >( x.raw() ) );
+}
+
+/**
+ * x + y, x - y and -x, with the range of the result.
+ */
+template< typename Q, intmax_t A, intmax_t B, intmax_t C, intmax_t D, typename P1, typename P2 >
+inline bounded<Q, A + C, B + D, P1> operator+( bounded<Q, A, B, P1> const & x, bounded<Q, C, D, P2> const & y )
+{
+    return bounded<Q, A + C, B + D, P1>( detail::bounded_unchecked(), ( x.value() + y.value() ).value() );
+}
+
+template< typename Q, intmax_t A, intmax_t B, intmax_t C, intmax_t D, typename P1, typename P2 >
+inline bounded<Q, A - D, B - C, P1> operator-( bounded<Q, A, B, P1> const & x, bounded<Q, C, D, P2> const & y )
+{
+    return bounded<Q, A - D, B - C, P1>( detail::bounded_unchecked(), ( x.value() - y.value() ).value() );
+}
+
+template< typename Q, intmax_t A, intmax_t B, typename P >
+inline bounded<Q, -B, -A, P> operator-( bounded<Q, A, B, P> const & x )
+{
+    return bounded<Q, -B, -A, P>( detail::bounded_unchecked(), ( -x.value() ).value() );
+}
+
+/**
+ * x * y and x / y, where Q * Q and Q / Q give Q; y may not include zero.
+ */
+template< typename Q, intmax_t A, intmax_t B, intmax_t C, intmax_t D, typename P1, typename P2,
+    typename = typename std::enable_if< std::is_same< decltype( std::declval<Q>() * std::declval<Q>() ), Q >::value >::type >
+inline bounded<Q, detail::bounded_multiply<A, B, C, D>::lo, detail::bounded_multiply<A, B, C, D>::hi, P1>
+operator*( bounded<Q, A, B, P1> const & x, bounded<Q, C, D, P2> const & y )
+{
+    return bounded<Q, detail::bounded_multiply<A, B, C, D>::lo, detail::bounded_multiply<A, B, C, D>::hi, P1>(
+        detail::bounded_unchecked(), ( x.value() * y.value() ).value() );
+}
+
+template< typename Q, intmax_t A, intmax_t B, intmax_t C, intmax_t D, typename P1, typename P2,
+    typename = typename std::enable_if< ( C > 0 || D < 0 ) && std::is_same< decltype( std::declval<Q>() / std::declval<Q>() ), Q >::value >::type >
+inline bounded<Q, detail::bounded_divide<A, B, C, D>::lo, detail::bounded_divide<A, B, C, D>::hi, P1>
+operator/( bounded<Q, A, B, P1> const & x, bounded<Q, C, D, P2> const & y )
+{
+    return bounded<Q, detail::bounded_divide<A, B, C, D>::lo, detail::bounded_divide<A, B, C, D>::hi, P1>(
+        detail::bounded_unchecked(), ( x.value() / y.value() ).value() );
+}
+
+/**
+ * comparisons of bounded values of Q with any range.
+ */
+#define G_WV_BOUNDED_COMPARISON( op ) \
+    template< typename Q, intmax_t A, intmax_t B, intmax_t C, intmax_t D, typename P1, typename P2 > \
+    inline bool operator op( bounded<Q, A, B, P1> const & x, bounded<Q, C, D, P2> const & y ) \
+    { \
+        return x.raw() op y.raw(); \
+    }
+
+G_WV_BOUNDED_COMPARISON( == )
+G_WV_BOUNDED_COMPARISON( != )
+G_WV_BOUNDED_COMPARISON( <  )
+G_WV_BOUNDED_COMPARISON( <= )
+G_WV_BOUNDED_COMPARISON( >  )
+G_WV_BOUNDED_COMPARISON( >= )
+
+#undef G_WV_BOUNDED_COMPARISON
+
+/**
+ * value as underlying type, integer (long) and real (double).
+ */
+template< typename Q, intmax_t Min, intmax_t Max, typename P > inline typename Q::value_type to_value( bounded<Q, Min, Max, P> const & x ) { return x.raw(); }
+template< typename Q, intmax_t Min, intmax_t Max, typename P > inline long to_integer( bounded<Q, Min, Max, P> const & x ) { return long( x.raw() ); }
+template< typename Q, intmax_t Min, intmax_t Max, typename P > inline double to_real( bounded<Q, Min, Max, P> const & x ) { return double( x.raw() ); }
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_BOUNDED_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,474 @@
+/*
+ * whole_value_checked.h
+ * arithmetic and quantity types whose integer operations detect overflow.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * checked_arithmetic<T, TG, Policy> and checked_quantity<T, TG, Policy> offer
+ * the operations of arithmetic<T, TG> and quantity<T, TG> for an integral
+ * type T, but every + - * / % ++ -- and unary minus, and the scaling of a
+ * quantity, reports a result that does not fit T to Policy::overflow(). So
+ * do division and remainder by zero. With GCC and Clang the checks use
+ * __builtin_add_overflow() and friends, which compile to the operation plus
+ * a jump on the overflow flag; otherwise they compare against the limits.
+ *
+ * Policies:
+ * - throw_on_overflow:    throw std::overflow_error,
+ * - trap_on_overflow:     stop the program (__builtin_trap(), or abort()),
+ * - callback_on_overflow: call the handler set with set_overflow_handler(),
+ * - sticky_overflow:      set a per-thread flag, read and cleared with
+ *                         sticky_overflow::test_and_clear().
+ * When the policy returns, the result is the wrapped value, and zero for
+ * division and remainder by zero.
+ *
+ * Use WV_DEFINE_CHECKED_ARITHMETIC_TYPE() and WV_DEFINE_CHECKED_QUANTITY_TYPE()
+ * to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_CHECKED_H_INCLUDED
+#define G_WV_WHOLE_VALUE_CHECKED_H_INCLUDED
+
+#include "whole_value.h"
+
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * create checked arithmetic value type.
+ */
+#define WV_DEFINE_CHECKED_ARITHMETIC_TYPE( type_name, underlying_type, policy ) \
+    struct type_name##_tag{}; \
+    typedef ::wv::checked_arithmetic<underlying_type, type_name##_tag, policy> type_name;
+
+/**
+ * create checked quantity value type.
+ */
+#define WV_DEFINE_CHECKED_QUANTITY_TYPE( type_name, underlying_type, policy ) \
+    struct type_name##_tag{}; \
+    typedef ::wv::checked_quantity<underlying_type, type_name##_tag, policy> type_name;
+
+#if defined( __GNUC__ ) && ( __GNUC__ >= 5 || defined( __clang__ ) )
+# define G_WV_HAVE_BUILTIN_OVERFLOW
+# define G_WV_UNLIKELY( x ) __builtin_expect( !!( x ), 0 )
+#else
+# define G_WV_UNLIKELY( x ) ( x )
+#endif
+
+namespace wv {
+
+/**
+ * overflow policy: throw std::overflow_error.
+ */
+struct throw_on_overflow
+{
+    static void overflow( char const * const what )
+    {
+        throw std::overflow_error( what );
+    }
+};
+
+/**
+ * overflow policy: stop the program.
+ */
+struct trap_on_overflow
+{
+    static void overflow( char const * const )
+    {
+#if defined( __GNUC__ )
+        __builtin_trap();
+#else
+        std::abort();
+#endif
+    }
+};
+
+/**
+ * overflow handler for callback_on_overflow.
+ */
+typedef void ( * overflow_handler )( char const * what );
+
+namespace detail {
+
+    inline void abort_on_overflow( char const * const ) { std::abort(); }
+
+    inline overflow_handler & current_overflow_handler()
+    {
+        static overflow_handler handler = &abort_on_overflow;
+        return handler;
+    }
+
+} // namespace detail
+
+/**
+ * set the handler of callback_on_overflow, return the previous one; the
+ * initial handler calls abort().
+ */
+inline overflow_handler set_overflow_handler( overflow_handler const handler )
+{
+    overflow_handler const previous = detail::current_overflow_handler();
+    detail::current_overflow_handler() = handler ? handler : &detail::abort_on_overflow;
+    return previous;
+}
+
+/**
+ * overflow policy: call the handler set with set_overflow_handler().
+ */
+struct callback_on_overflow
+{
+    static void overflow( char const * const what )
+    {
+        detail::current_overflow_handler()( what );
+    }
+};
+
+/**
+ * overflow policy: set a per-thread flag.
+ */
+struct sticky_overflow
+{
+    static void overflow( char const * const )
+    {
+        flag() = true;
+    }
+
+    /**
+     * whether an overflow occurred in this thread since the last call.
+     */
+    static bool test_and_clear()
+    {
+        bool const result = flag();
+        flag() = false;
+        return result;
+    }
+
+    static bool test()
+    {
+        return flag();
+    }
+
+private:
+    static bool & flag()
+    {
+        static thread_local bool overflowed = false;
+        return overflowed;
+    }
+};
+
+namespace detail {
+
+    /**
+     * x modulo 2^bits of T, as T.
+     */
+    template< typename T >
+    T wrap( unsigned long long const x )
+    {
+        return static_cast<T>( x );
+    }
+
+    template< typename T >
+    bool add_overflow( T const a, T const b, T & r )
+    {
+#ifdef G_WV_HAVE_BUILTIN_OVERFLOW
+        return __builtin_add_overflow( a, b, &r );
+#else
+        typedef std::numeric_limits<T> limits;
+        bool const o = limits::is_signed
+            ? ( b > 0 ? a > limits::max() - b : a < limits::min() - b )
+            : a > limits::max() - b;
+        r = wrap<T>( static_cast<unsigned long long>( a ) + static_cast<unsigned long long>( b ) );
+        return o;
+#endif
+    }
+
+    template< typename T >
+    bool sub_overflow( T const a, T const b, T & r )
+    {
+#ifdef G_WV_HAVE_BUILTIN_OVERFLOW
+        return __builtin_sub_overflow( a, b, &r );
+#else
+        typedef std::numeric_limits<T> limits;
+        bool const o = limits::is_signed
+            ? ( b > 0 ? a < limits::min() + b : a > limits::max() + b )
+            : a < b;
+        r = wrap<T>( static_cast<unsigned long long>( a ) - static_cast<unsigned long long>( b ) );
+        return o;
+#endif
+    }
+
+    template< typename T >
+    bool mul_overflow( T const a, T const b, T & r )
+    {
+#ifdef G_WV_HAVE_BUILTIN_OVERFLOW
+        return __builtin_mul_overflow( a, b, &r );
+#else
+        typedef std::numeric_limits<T> limits;
+        bool o = false;
+        if ( a != 0 && b != 0 )
+        {
+            if ( !limits::is_signed )
+                o = a > limits::max() / b;
+            else if ( a > 0 )
+                o = b > 0 ? a > limits::max() / b : b < limits::min() / a;
+            else
+                o = b > 0 ? a < limits::min() / b : b < limits::max() / a;
+        }
+        r = wrap<T>( static_cast<unsigned long long>( a ) * static_cast<unsigned long long>( b ) );
+        return o;
+#endif
+    }
+
+    /**
+     * operations on T that report overflow to Policy.
+     */
+    template< typename T, typename Policy >
+    struct checked_ops
+    {
+        static_assert( std::is_integral<T>::value, "checked types need an integral underlying type" );
+
+        static T add( T const a, T const b )
+        {
+            T r;
+            if ( G_WV_UNLIKELY( add_overflow( a, b, r ) ) )
+                Policy::overflow( "wv: overflow in addition" );
+            return r;
+        }
+
+        static T sub( T const a, T const b )
+        {
+            T r;
+            if ( G_WV_UNLIKELY( sub_overflow( a, b, r ) ) )
+                Policy::overflow( "wv: overflow in subtraction" );
+            return r;
+        }
+
+        static T mul( T const a, T const b )
+        {
+            T r;
+            if ( G_WV_UNLIKELY( mul_overflow( a, b, r ) ) )
+                Policy::overflow( "wv: overflow in multiplication" );
+            return r;
+        }
+
+        static T div( T const a, T const b )
+        {
+            if ( G_WV_UNLIKELY( b == 0 ) )
+            {
+                Policy::overflow( "wv: division by zero" );
+                return T( 0 );
+            }
+            if ( G_WV_UNLIKELY( is_min_by_minus_one( a, b ) ) )
+            {
+                Policy::overflow( "wv: overflow in division" );
+                return a;
+            }
+            return T( a / b );
+        }
+
+        static T mod( T const a, T const b )
+        {
+            if ( G_WV_UNLIKELY( b == 0 ) )
+            {
+                Policy::overflow( "wv: remainder by zero" );
+                return T( 0 );
+            }
+            // the remainder of min / -1 is 0, but computing it traps on x86:
+            return is_min_by_minus_one( a, b ) ? T( 0 ) : T( a % b );
+        }
+
+        static T neg( T const a )
+        {
+            return sub( T( 0 ), a );
+        }
+
+        static bool is_min_by_minus_one( T const a, T const b )
+        {
+            return std::numeric_limits<T>::is_signed && b == T( -1 ) && a == std::numeric_limits<T>::min();
+        }
+    };
+
+} // namespace detail
+
+/**
+ * arithmetic type (dimensionless) with overflow checks.
+ */
+template< typename T, typename TG, typename Policy = throw_on_overflow >
+class checked_arithmetic
+{
+    typedef detail::checked_ops<T, Policy> ops;
+
+public:
+    typedef T value_type;
+    typedef Policy policy_type;
+    typedef arithmetic<T,TG> unchecked_type;
+
+    checked_arithmetic() : m_value( value_type() ) {}
+
+    WV_EXPLICIT_ARITHMETIC checked_arithmetic( value_type const value ) : m_value( value ) {}
+
+    explicit checked_arithmetic( unchecked_type const & x ) : m_value( x.value() ) {}
+
+    value_type value() const { return m_value; }
+
+    template<typename U>
+    U as() const { return static_cast<U>( m_value ); }
+
+    /**
+     * the same value as unchecked arithmetic type.
+     */
+    unchecked_type unchecked() const { return unchecked_type( m_value ); }
+
+    friend void swap( checked_arithmetic & first, checked_arithmetic & second )
+    {
+        std::swap( first.m_value, second.m_value );
+    }
+
+    friend bool operator==( checked_arithmetic const & x, checked_arithmetic const & y ) { return x.m_value == y.m_value; }
+    friend bool operator!=( checked_arithmetic const & x, checked_arithmetic const & y ) { return x.m_value != y.m_value; }
+    friend bool operator< ( checked_arithmetic const & x, checked_arithmetic const & y ) { return x.m_value <  y.m_value; }
+    friend bool operator> ( checked_arithmetic const & x, checked_arithmetic const & y ) { return x.m_value >  y.m_value; }
+    friend bool operator<=( checked_arithmetic const & x, checked_arithmetic const & y ) { return x.m_value <= y.m_value; }
+    friend bool operator>=( checked_arithmetic const & x, checked_arithmetic const & y ) { return x.m_value >= y.m_value; }
+
+    checked_arithmetic operator+() const { return *this; }
+    checked_arithmetic operator-() const { return checked_arithmetic( ops::neg( m_value ) ); }
+
+    checked_arithmetic & operator++() { m_value = ops::add( m_value, value_type( 1 ) ); return *this; }
+    checked_arithmetic & operator--() { m_value = ops::sub( m_value, value_type( 1 ) ); return *this; }
+
+    checked_arithmetic operator++( int ) { checked_arithmetic tmp( *this ); ++*this; return tmp; }
+    checked_arithmetic operator--( int ) { checked_arithmetic tmp( *this ); --*this; return tmp; }
+
+    checked_arithmetic & operator+=( checked_arithmetic const & other ) { m_value = ops::add( m_value, other.m_value ); return *this; }
+    checked_arithmetic & operator-=( checked_arithmetic const & other ) { m_value = ops::sub( m_value, other.m_value ); return *this; }
+    checked_arithmetic & operator*=( checked_arithmetic const & other ) { m_value = ops::mul( m_value, other.m_value ); return *this; }
+    checked_arithmetic & operator/=( checked_arithmetic const & other ) { m_value = ops::div( m_value, other.m_value ); return *this; }
+    checked_arithmetic & operator%=( checked_arithmetic const & other ) { m_value = ops::mod( m_value, other.m_value ); return *this; }
+
+    friend checked_arithmetic operator+( checked_arithmetic const & x, checked_arithmetic const & y ) { return checked_arithmetic( ops::add( x.m_value, y.m_value ) ); }
+    friend checked_arithmetic operator-( checked_arithmetic const & x, checked_arithmetic const & y ) { return checked_arithmetic( ops::sub( x.m_value, y.m_value ) ); }
+    friend checked_arithmetic operator*( checked_arithmetic const & x, checked_arithmetic const & y ) { return checked_arithmetic( ops::mul( x.m_value, y.m_value ) ); }
+    friend checked_arithmetic operator/( checked_arithmetic const & x, checked_arithmetic const & y ) { return checked_arithmetic( ops::div( x.m_value, y.m_value ) ); }
+    friend checked_arithmetic operator%( checked_arithmetic const & x, checked_arithmetic const & y ) { return checked_arithmetic( ops::mod( x.m_value, y.m_value ) ); }
+
+private:
+    value_type m_value;
+};
+
+/**
+ * quantity type with overflow checks.
+ */
+template< typename T, typename TG, typename Policy = throw_on_overflow >
+class checked_quantity
+{
+    typedef detail::checked_ops<T, Policy> ops;
+
+public:
+    typedef T value_type;
+    typedef Policy policy_type;
+    typedef quantity<T,TG> unchecked_type;
+
+    checked_quantity() : m_value( value_type() ) {}
+
+    WV_EXPLICIT_QUANTITY checked_quantity( value_type const value ) : m_value( value ) {}
+
+    explicit checked_quantity( unchecked_type const & x ) : m_value( x.value() ) {}
+
+    value_type value() const { return m_value; }
+
+    template<typename U>
+    U as() const { return static_cast<U>( m_value ); }
+
+    /**
+     * the same value as unchecked quantity type.
+     */
+    unchecked_type unchecked() const { return unchecked_type( m_value ); }
+
+    friend void swap( checked_quantity & first, checked_quantity & second )
+    {
+        std::swap( first.m_value, second.m_value );
+    }
+
+    friend bool operator==( checked_quantity const & x, checked_quantity const & y ) { return x.m_value == y.m_value; }
+    friend bool operator!=( checked_quantity const & x, checked_quantity const & y ) { return x.m_value != y.m_value; }
+    friend bool operator< ( checked_quantity const & x, checked_quantity const & y ) { return x.m_value <  y.m_value; }
+    friend bool operator> ( checked_quantity const & x, checked_quantity const & y ) { return x.m_value >  y.m_value; }
+    friend bool operator<=( checked_quantity const & x, checked_quantity const & y ) { return x.m_value <= y.m_value; }
+    friend bool operator>=( checked_quantity const & x, checked_quantity const & y ) { return x.m_value >= y.m_value; }
+
+    checked_quantity operator+() const { return *this; }
+    checked_quantity operator-() const { return checked_quantity( ops::neg( m_value ) ); }
+
+    checked_quantity & operator++() { m_value = ops::add( m_value, value_type( 1 ) ); return *this; }
+    checked_quantity & operator--() { m_value = ops::sub( m_value, value_type( 1 ) ); return *this; }
+
+    checked_quantity operator++( int ) { checked_quantity tmp( *this ); ++*this; return tmp; }
+    checked_quantity operator--( int ) { checked_quantity tmp( *this ); --*this; return tmp; }
+
+    checked_quantity & operator+=( checked_quantity const & other ) { m_value = ops::add( m_value, other.m_value ); return *this; }
+    checked_quantity & operator-=( checked_quantity const & other ) { m_value = ops::sub( m_value, other.m_value ); return *this; }
+
+#ifndef WV_ALLOW_CONVERSION_FROM_UNDERLYING_TYPE_FOR_QUANTITY
+private:
+#endif
+    checked_quantity & operator*=( value_type const value ) { m_value = ops::mul( m_value, value ); return *this; }
+    checked_quantity & operator/=( value_type const value ) { m_value = ops::div( m_value, value ); return *this; }
+    checked_quantity & operator%=( value_type const value ) { m_value = ops::mod( m_value, value ); return *this; }
+
+public:
+    friend checked_quantity operator+( checked_quantity const & x, checked_quantity const & y ) { return checked_quantity( ops::add( x.m_value, y.m_value ) ); }
+    friend checked_quantity operator-( checked_quantity const & x, checked_quantity const & y ) { return checked_quantity( ops::sub( x.m_value, y.m_value ) ); }
+
+    friend checked_quantity operator*( checked_quantity const & x, value_type const y ) { return checked_quantity( ops::mul( x.m_value, y ) ); }
+    friend checked_quantity operator*( value_type const x, checked_quantity const & y ) { return checked_quantity( ops::mul( x, y.m_value ) ); }
+
+    friend checked_quantity operator/( checked_quantity const & x, value_type const y ) { return checked_quantity( ops::div( x.m_value, y ) ); }
+    friend checked_quantity operator%( checked_quantity const & x, value_type const y ) { return checked_quantity( ops::mod( x.m_value, y ) ); }
+
+private:
+    value_type m_value;
+};
+
+/**
+ * return absolute value; the absolute value of the minimum overflows.
+ */
+template < typename T, typename U, typename P >
+inline checked_arithmetic<T,U,P> abs( checked_arithmetic<T,U,P> const & x )
+{
+    return x.value() < 0 ? -x : x;
+}
+
+template < typename T, typename U, typename P >
+inline checked_quantity<T,U,P> abs( checked_quantity<T,U,P> const & x )
+{
+    return x.value() < 0 ? -x : x;
+}
+
+/**
+ * value as underlying type, integer (long) and real (double).
+ */
+template < typename T, typename U, typename P > inline T to_value( checked_arithmetic<T,U,P> const & x ) { return x.value(); }
+template < typename T, typename U, typename P > inline T to_value(   checked_quantity<T,U,P> const & x ) { return x.value(); }
+
+template < typename T, typename U, typename P > inline long to_integer( checked_arithmetic<T,U,P> const & x ) { return x.value(); }
+template < typename T, typename U, typename P > inline long to_integer(   checked_quantity<T,U,P> const & x ) { return x.value(); }
+
+template < typename T, typename U, typename P > inline double to_real( checked_arithmetic<T,U,P> const & x ) { return x.value(); }
+template < typename T, typename U, typename P > inline double to_real(   checked_quantity<T,U,P> const & x ) { return x.value(); }
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_CHECKED_H_INCLUDED
+
+/*
+ * end of file
+ */
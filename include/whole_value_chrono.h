@@ -0,0 +1,221 @@
+/*
+ * whole_value_chrono.h
+ * conversions between std::chrono and duration and timestamp quantities.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * A quantity is a duration when its tag declares a period, a std::ratio of
+ * seconds, as WV_DEFINE_DURATION_TYPE() does; scaled<T, Family, Ratio> of
+ * whole_value_unit.h declares Ratio. A point<V, TG> of whole_value_affine.h
+ * is a time point when V is a duration and TG declares a clock, as
+ * WV_DEFINE_TIME_POINT_TYPE() does.
+ *
+ * to_duration() and to_time_point() give the std::chrono value with the same
+ * representation and period; from_duration<Q>() and from_time_point<P>()
+ * convert back, implicitly converting the period where chrono allows it
+ * (without loss), and from_duration_cast<Q>() truncates like duration_cast.
+ * All are constexpr, and compile to a plain copy of the count.
+ *
+ * as_quantities<Q>() and as_durations() view a span of chrono durations as
+ * a span of quantities and back, and as_points<P>() and as_time_points() do
+ * so for time points, without copying. As values() of whole_value_span.h,
+ * this relies on the types having the layout of their single count, which
+ * is checked, and representation and period must be equal.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_CHRONO_H_INCLUDED
+#define G_WV_WHOLE_VALUE_CHRONO_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_affine.h"
+#include "whole_value_span.h"
+
+#include <chrono>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+/**
+ * create duration quantity type with period ratio (of seconds).
+ */
+#define WV_DEFINE_DURATION_TYPE( type_name, underlying_type, ratio ) \
+    struct type_name##_tag { typedef ratio::type period; }; \
+    typedef ::wv::quantity<underlying_type, type_name##_tag> type_name;
+
+/**
+ * create time point type of clock clock_type with duration type duration_type.
+ */
+#define WV_DEFINE_TIME_POINT_TYPE( type_name, duration_type, clock_type ) \
+    struct type_name##_tag { typedef clock_type clock; }; \
+    typedef ::wv::point<duration_type, type_name##_tag> type_name;
+
+namespace wv {
+
+namespace detail {
+
+    /**
+     * tag of a quantity, or of the quantity a type derives from.
+     */
+    template< typename T, typename TG >
+    TG quantity_tag( quantity<T,TG> const * );
+
+    template< typename V, typename TG >
+    TG point_tag( point<V,TG> const * );
+
+} // namespace detail
+
+/**
+ * std::chrono::duration of duration quantity Q.
+ */
+template< typename Q >
+using duration_of = std::chrono::duration< typename Q::value_type, typename decltype( detail::quantity_tag( std::declval<Q const *>() ) )::period >;
+
+/**
+ * std::chrono::time_point of time point P.
+ */
+template< typename P >
+using time_point_of = std::chrono::time_point< typename decltype( detail::point_tag( std::declval<P const *>() ) )::clock, duration_of< typename P::vector_type > >;
+
+/**
+ * x as std::chrono::duration.
+ */
+template< typename T, typename TG >
+inline constexpr std::chrono::duration<T, typename TG::period> to_duration( quantity<T,TG> const & x )
+{
+    return std::chrono::duration<T, typename TG::period>( x.value() );
+}
+
+/**
+ * d as duration quantity Q, where the period converts without loss.
+ */
+template< typename Q, typename Rep, typename Period >
+inline constexpr Q from_duration( std::chrono::duration<Rep, Period> const & d )
+{
+    return Q( duration_of<Q>( d ).count() );
+}
+
+/**
+ * d as duration quantity Q, truncated toward zero.
+ */
+template< typename Q, typename Rep, typename Period >
+inline constexpr Q from_duration_cast( std::chrono::duration<Rep, Period> const & d )
+{
+    return Q( std::chrono::duration_cast< duration_of<Q> >( d ).count() );
+}
+
+/**
+ * x as std::chrono::time_point.
+ */
+template< typename V, typename TG >
+inline constexpr time_point_of< point<V,TG> > to_time_point( point<V,TG> const & x )
+{
+    return time_point_of< point<V,TG> >( to_duration( x.since_origin() ) );
+}
+
+/**
+ * t as time point P of the same clock, where the period converts without loss.
+ */
+template< typename P, typename Clock, typename Duration >
+inline constexpr P from_time_point( std::chrono::time_point<Clock, Duration> const & t )
+{
+    static_assert( std::is_same< Clock, typename time_point_of<P>::clock >::value, "from_time_point: different clocks" );
+
+    return P::from_origin( from_duration< typename P::vector_type >( t.time_since_epoch() ) );
+}
+
+namespace detail {
+
+    template< typename To, typename From >
+    span<To> reinterpret_span( span<From> const & s )
+    {
+        static_assert( sizeof( To ) == sizeof( From ), "chrono value and whole value must have the same size" );
+
+        return span<To>( reinterpret_cast<To *>( s.data() ), s.size() );
+    }
+
+    template< typename Q, typename D >
+    struct same_duration
+    {
+        static const bool value = std::is_same< typename duration_of<Q>::rep, typename D::rep >::value &&
+            std::ratio_equal< typename duration_of<Q>::period, typename D::period >::value;
+    };
+
+} // namespace detail
+
+/**
+ * view durations as duration quantities Q and back.
+ */
+template< typename Q, typename Rep, typename Period >
+inline span<Q> as_quantities( span< std::chrono::duration<Rep, Period> > const & s )
+{
+    static_assert( detail::same_duration< Q, std::chrono::duration<Rep, Period> >::value, "as_quantities: different representation or period" );
+
+    return detail::reinterpret_span<Q>( s );
+}
+
+template< typename Q, typename Rep, typename Period >
+inline span<Q const> as_quantities( span< std::chrono::duration<Rep, Period> const > const & s )
+{
+    static_assert( detail::same_duration< Q, std::chrono::duration<Rep, Period> >::value, "as_quantities: different representation or period" );
+
+    return detail::reinterpret_span<Q const>( s );
+}
+
+template< typename Q >
+inline span< duration_of<Q> > as_durations( span<Q> const & s )
+{
+    return detail::reinterpret_span< duration_of<Q> >( s );
+}
+
+template< typename Q >
+inline span< duration_of<Q> const > as_durations( span<Q const> const & s )
+{
+    return detail::reinterpret_span< duration_of<Q> const >( s );
+}
+
+/**
+ * view time points as time points P of the same clock and back.
+ */
+template< typename P, typename Clock, typename Duration >
+inline span<P> as_points( span< std::chrono::time_point<Clock, Duration> > const & s )
+{
+    static_assert( std::is_same< std::chrono::time_point<Clock, Duration>, time_point_of<P> >::value, "as_points: different clock, representation or period" );
+
+    return detail::reinterpret_span<P>( s );
+}
+
+template< typename P, typename Clock, typename Duration >
+inline span<P const> as_points( span< std::chrono::time_point<Clock, Duration> const > const & s )
+{
+    static_assert( std::is_same< std::chrono::time_point<Clock, Duration>, time_point_of<P> >::value, "as_points: different clock, representation or period" );
+
+    return detail::reinterpret_span<P const>( s );
+}
+
+template< typename P >
+inline span< time_point_of<P> > as_time_points( span<P> const & s )
+{
+    return detail::reinterpret_span< time_point_of<P> >( s );
+}
+
+template< typename P >
+inline span< time_point_of<P> const > as_time_points( span<P const> const & s )
+{
+    return detail::reinterpret_span< time_point_of<P> const >( s );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_CHRONO_H_INCLUDED
+
+/*
+ * end of file
+ */
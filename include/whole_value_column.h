@@ -0,0 +1,340 @@
+/*
+ * whole_value_column.h
+ * huge-page allocator and first-touch initialized column of whole values.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * On Linux, huge_page_allocator obtains large blocks directly with mmap(),
+ * aligned to the huge page size, and asks for transparent huge pages with
+ * madvise( MADV_HUGEPAGE ). The pages are not touched by the allocator, so the
+ * physical memory of a page is placed on the NUMA node of the thread that
+ * first writes it ("first touch"). column<> uses that: it constructs its
+ * elements with parallel_for(), so each worker thread initializes, and thereby
+ * places, its own chunk. Scan a column with parallel_for() and the same thread
+ * count and every thread reads node-local memory.
+ *
+ * On a single-node machine, or when transparent huge pages are disabled, this
+ * all still works; only the placement benefit is absent. On other platforms
+ * the allocator falls back to operator new.
+ *
+ * Macros to control behaviour:
+ * - WV_HUGE_PAGE_SIZE: huge page size in bytes, default 2 MiB.
+ * - WV_HUGE_PAGE_THRESHOLD: blocks smaller than this are obtained with
+ *   operator new, default WV_HUGE_PAGE_SIZE.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_COLUMN_H_INCLUDED
+#define G_WV_WHOLE_VALUE_COLUMN_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_parallel.h"
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined( __linux__ )
+# include <sys/mman.h>
+# define G_WV_HAVE_MMAP
+#endif
+
+#ifndef WV_HUGE_PAGE_SIZE
+# define WV_HUGE_PAGE_SIZE ( std::size_t( 2 ) * 1024 * 1024 )
+#endif
+
+#ifndef WV_HUGE_PAGE_THRESHOLD
+# define WV_HUGE_PAGE_THRESHOLD WV_HUGE_PAGE_SIZE
+#endif
+
+namespace wv {
+
+namespace detail {
+
+    inline std::size_t round_up( std::size_t const n, std::size_t const m )
+    {
+        return ( n + m - 1 ) / m * m;
+    }
+
+    /**
+     * allocate huge-page aligned, untouched memory of at least 'bytes'.
+     */
+    inline void * allocate_huge( std::size_t const bytes )
+    {
+#ifdef G_WV_HAVE_MMAP
+        std::size_t const size  = round_up( bytes, WV_HUGE_PAGE_SIZE );
+        std::size_t const total = size + WV_HUGE_PAGE_SIZE;
+
+        void * const p = ::mmap( 0, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+        if ( p == MAP_FAILED )
+            throw std::bad_alloc();
+
+        // trim to a huge page aligned block:
+
+        char * const base  = static_cast<char *>( p );
+        char * const first = base + ( WV_HUGE_PAGE_SIZE - reinterpret_cast<std::size_t>( base ) % WV_HUGE_PAGE_SIZE ) % WV_HUGE_PAGE_SIZE;
+        char * const last  = first + size;
+
+        if ( first != base )
+            ::munmap( base, first - base );
+
+        if ( base + total != last )
+            ::munmap( last, base + total - last );
+
+# ifdef MADV_HUGEPAGE
+        // a refusal, e.g. THP disabled, only costs the huge page benefit:
+        (void) ::madvise( first, size, MADV_HUGEPAGE );
+# endif
+        return first;
+#else
+        return ::operator new( bytes );
+#endif
+    }
+
+    inline void deallocate_huge( void * const p, std::size_t const bytes )
+    {
+#ifdef G_WV_HAVE_MMAP
+        ::munmap( p, round_up( bytes, WV_HUGE_PAGE_SIZE ) );
+#else
+        (void) bytes;
+        ::operator delete( p );
+#endif
+    }
+} // namespace detail
+
+/**
+ * allocator that serves large blocks from transparent huge pages.
+ */
+template< typename T >
+class huge_page_allocator
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template< typename U >
+    struct rebind { typedef huge_page_allocator<U> other; };
+
+    huge_page_allocator() {}
+
+    template< typename U >
+    huge_page_allocator( huge_page_allocator<U> const & ) {}
+
+    T * allocate( size_type const n )
+    {
+        if ( n > max_size() )
+            throw std::bad_alloc();
+
+        size_type const bytes = n * sizeof( T );
+
+        if ( bytes < WV_HUGE_PAGE_THRESHOLD )
+            return static_cast<T *>( ::operator new( bytes ) );
+
+        return static_cast<T *>( detail::allocate_huge( bytes ) );
+    }
+
+    void deallocate( T * const p, size_type const n )
+    {
+        size_type const bytes = n * sizeof( T );
+
+        if ( bytes < WV_HUGE_PAGE_THRESHOLD )
+            ::operator delete( p );
+        else
+            detail::deallocate_huge( p, bytes );
+    }
+
+    size_type max_size() const
+    {
+        return ( std::numeric_limits<size_type>::max )() / sizeof( T );
+    }
+
+    friend bool operator==( huge_page_allocator const &, huge_page_allocator const & ) { return true;  }
+    friend bool operator!=( huge_page_allocator const &, huge_page_allocator const & ) { return false; }
+};
+
+/**
+ * fixed-size array of whole values with parallel first-touch initialization.
+ */
+template< typename Q, typename A = huge_page_allocator<Q> >
+class column
+{
+public:
+    typedef Q value_type;
+    typedef A allocator_type;
+    typedef std::size_t size_type;
+    typedef Q * iterator;
+    typedef Q const * const_iterator;
+
+    column() : m_data( 0 ), m_size( 0 ), m_threads( 1 ) {}
+
+    /**
+     * create column of n copies of x, initialized by 'threads' threads
+     * (0: hardware_threads()).
+     */
+    explicit column( size_type const n, Q const & x = Q(), unsigned const threads = 0 )
+    : m_data( 0 ), m_size( 0 ), m_threads( threads ? threads : hardware_threads() )
+    {
+        m_data = m_alloc.allocate( n );
+        m_size = n;
+
+        construct( [&x]( Q * const p, size_type ) { ::new( static_cast<void *>( p ) ) Q( x ); } );
+    }
+
+    column( column const & other )
+    : m_data( 0 ), m_size( 0 ), m_threads( other.m_threads )
+    {
+        m_data = m_alloc.allocate( other.m_size );
+        m_size = other.m_size;
+
+        Q const * const from = other.m_data;
+
+        construct( [from]( Q * const p, size_type i ) { ::new( static_cast<void *>( p ) ) Q( from[i] ); } );
+    }
+
+    column( column && other )
+    : m_data( other.m_data ), m_size( other.m_size ), m_threads( other.m_threads )
+    {
+        other.m_data = 0;
+        other.m_size = 0;
+    }
+
+    column & operator=( column other )
+    {
+        swap( *this, other );
+        return *this;
+    }
+
+    ~column()
+    {
+        if ( m_data )
+        {
+            for ( size_type i = 0; i < m_size; ++i )
+                m_data[i].~Q();
+
+            m_alloc.deallocate( m_data, m_size );
+        }
+    }
+
+    friend void swap( column & first, column & second )
+    {
+        using std::swap;
+        swap( first.m_data, second.m_data );
+        swap( first.m_size, second.m_size );
+        swap( first.m_threads, second.m_threads );
+    }
+
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * number of threads that placed the pages; use it to scan the column.
+     */
+    unsigned threads() const { return m_threads; }
+
+    /**
+     * elements per partition step, a whole number of huge pages where possible.
+     */
+    size_type grain() const
+    {
+        return sizeof( Q ) < WV_HUGE_PAGE_SIZE ? WV_HUGE_PAGE_SIZE / sizeof( Q ) : 1;
+    }
+
+    /**
+     * chunk of this column that was first touched by thread 'index'.
+     */
+    index_range partition( unsigned const index ) const
+    {
+        return wv::partition( 0, m_size, index, m_threads, grain() );
+    }
+
+    Q * data() { return m_data; }
+    Q const * data() const { return m_data; }
+
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+    Q & operator[]( size_type const i ) { return m_data[i]; }
+    Q const & operator[]( size_type const i ) const { return m_data[i]; }
+
+    /**
+     * call f( first, last, thread ) for the chunks in placement order.
+     */
+    template< typename F >
+    void for_each_partition( F f ) const
+    {
+        parallel_for( 0, m_size, m_threads, f, grain() );
+    }
+
+private:
+    /**
+     * construct the elements with make( data + i, i ) in parallel; if one
+     * throws, destroy the elements constructed so far, release the storage
+     * and rethrow.
+     */
+    template< typename F >
+    void construct( F const & make )
+    {
+        Q * const data = m_data;
+        index_range const none = { 0, 0 };
+        std::vector<index_range> done( m_threads, none );
+
+        try
+        {
+            parallel_for( 0, m_size, m_threads, [data, &make, &done]( size_type first, size_type last, unsigned t )
+            {
+                size_type i = first;
+                try
+                {
+                    for ( ; i < last; ++i )
+                        make( data + i, i );
+                }
+                catch ( ... )
+                {
+                    while ( i != first )
+                        data[--i].~Q();
+                    throw;
+                }
+                index_range const r = { first, last };
+                done[t] = r;
+            }
+            , grain() );
+        }
+        catch ( ... )
+        {
+            for ( std::size_t t = 0; t < done.size(); ++t )
+                for ( size_type i = done[t].first; i < done[t].last; ++i )
+                    data[i].~Q();
+
+            m_alloc.deallocate( m_data, m_size );
+            m_data = 0;
+            m_size = 0;
+            throw;
+        }
+    }
+
+    allocator_type m_alloc;
+    Q * m_data;
+    size_type m_size;
+    unsigned m_threads;
+};
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_COLUMN_H_INCLUDED
+
+/*
+ * end of file
+ */
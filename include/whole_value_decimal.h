@@ -0,0 +1,441 @@
+/*
+ * whole_value_decimal.h
+ * decimal quantity type for money, with exact integer arithmetic.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * decimal<Digits, TG, Rounding, T> represents value() / 10^Digits with T
+ * int64_t, or int128_t where available (GCC, Clang) for a larger range.
+ * Like fixed (see whole_value_fixed.h), it has the operations of quantity;
+ * addition, subtraction and multiplication by an integer are exact, and
+ * division by an integer, scale() by a rational or decimal factor, parsing
+ * of more than Digits decimals, and to_integer() round after the Rounding
+ * policy, by default round_to_nearest_even (banker's rounding). scale()
+ * forms the product in twice the width of T: for int128_t in 256 bits, which
+ * is slow when the product exceeds 128 bits.
+ *
+ * parse() reads [+-]digits[.digits] from a character range without
+ * locale or allocation, and format() writes [-]digits.digits with exactly
+ * Digits decimals; to_string() and operator<< use format().
+ *
+ * Use WV_DEFINE_DECIMAL_TYPE() to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_DECIMAL_H_INCLUDED
+#define G_WV_WHOLE_VALUE_DECIMAL_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_fixed.h"
+
+#include <cassert>
+#include <cmath>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/**
+ * create decimal value type.
+ */
+#define WV_DEFINE_DECIMAL_TYPE( type_name, digits, rounding ) \
+    struct type_name##_tag{}; \
+    typedef ::wv::decimal<digits, type_name##_tag, rounding> type_name;
+
+namespace wv {
+
+namespace detail {
+
+    /**
+     * unsigned counterpart of the storage type, for digits.
+     */
+    template< typename T >
+    struct decimal_unsigned;
+
+    template<>
+    struct decimal_unsigned< int64_t >
+    {
+        typedef uint64_t type;
+        static const int max_digits = 19;
+    };
+
+#ifdef G_WV_HAVE_INT128
+    template<>
+    struct decimal_unsigned< int128_t >
+    {
+        typedef uint128_t type;
+        static const int max_digits = 38;
+    };
+#endif
+
+    template< typename T, int D >
+    struct power_of_ten
+    {
+        static const T value = T( 10 ) * power_of_ten<T, D - 1>::value;
+    };
+
+    template< typename T >
+    struct power_of_ten< T, 0 >
+    {
+        static const T value = T( 1 );
+    };
+
+    /**
+     * x * num / den, rounded, with the product in the type of fixed_wide.
+     */
+    template< typename Rounding >
+    int64_t decimal_multiply_divide( int64_t const x, int64_t const num, int64_t const den )
+    {
+        return multiply_divide< Rounding, fixed_wide<int64_t>::type >( x, num, den );
+    }
+
+#ifdef G_WV_HAVE_INT128
+    /**
+     * x * num / den, rounded, for 128-bit x: there is no wider integer type,
+     * so the product is formed in 256 bits, as two halves, and divided a bit
+     * at a time. The quotient must fit (asserted).
+     */
+    template< typename Rounding >
+    int128_t decimal_multiply_divide( int128_t const x, int128_t const num, int128_t const den )
+    {
+        bool const minus = negative( x ) != negative( num );
+        uint128_t const a = negative( x ) ? uint128_t( -uint128_t( x ) ) : uint128_t( x );
+        uint128_t const b = negative( num ) ? uint128_t( -uint128_t( num ) ) : uint128_t( num );
+        uint128_t const d = negative( den ) ? uint128_t( -uint128_t( den ) ) : uint128_t( den );
+
+        uint128_t const a0 = uint64_t( a ), a1 = a >> 64;
+        uint128_t const b0 = uint64_t( b ), b1 = b >> 64;
+        uint128_t const p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        uint128_t const middle = ( p00 >> 64 ) + uint64_t( p01 ) + uint64_t( p10 );
+        uint128_t const lo = ( middle << 64 ) | uint64_t( p00 );
+        uint128_t const hi = p11 + ( p01 >> 64 ) + ( p10 >> 64 ) + ( middle >> 64 );
+
+        uint128_t const max = ~uint128_t( 0 ) >> 1;
+
+        if ( hi == 0 && lo <= max )
+        {
+            int128_t const product = minus ? int128_t( -int128_t( lo ) ) : int128_t( lo );
+            return divide<Rounding>( product, den );
+        }
+
+        assert( hi < d && "decimal: scale() result out of range" );
+
+        uint128_t q = 0, r = hi;
+        for ( int i = 127; i >= 0; --i )
+        {
+            bool const carry = ( r >> 127 ) != 0;
+            r = ( r << 1 ) | ( ( lo >> i ) & 1 );
+            q <<= 1;
+            if ( carry || r >= d )
+            {
+                r -= d;
+                q |= 1;
+            }
+        }
+
+        assert( q <= max && "decimal: scale() result out of range" );
+
+        // the quotient has the sign of product / den, the remainder that of the product:
+        int128_t const sq = minus != negative( den ) ? int128_t( -int128_t( q ) ) : int128_t( q );
+        int128_t const sr = minus ? int128_t( -int128_t( r ) ) : int128_t( r );
+        return Rounding::adjust( sq, sr, den );
+    }
+#endif
+
+} // namespace detail
+
+/**
+ * decimal quantity: value() / 10^Digits.
+ */
+template< int Digits, typename TG, typename Rounding = round_to_nearest_even, typename T = int64_t >
+class decimal
+{
+    typedef typename detail::decimal_unsigned<T>::type unsigned_type;
+
+    static_assert( Digits >= 0 && Digits < detail::decimal_unsigned<T>::max_digits, "decimal: Digits out of range" );
+
+public:
+    typedef T value_type;
+    typedef Rounding rounding_type;
+
+    static const int digits = Digits;
+
+    /**
+     * the scaled integer of 1.
+     */
+    static const T one = detail::power_of_ten<T, Digits>::value;
+
+    /**
+     * characters that format() writes at most.
+     */
+    static const int max_chars = detail::decimal_unsigned<T>::max_digits + 3;
+
+    decimal() : m_value( value_type() ) {}
+
+    /**
+     * from the scaled integer.
+     */
+    explicit decimal( value_type const value ) : m_value( value ) {}
+
+    /**
+     * from an integer, exact if it fits.
+     */
+    static decimal from_integer( value_type const n ) { return decimal( value_type( n * one ) ); }
+
+    /**
+     * from a double, rounded to nearest; prefer parse() for exact input.
+     */
+    static decimal from_real( double const x ) { return decimal( value_type( std::round( x * double( one ) ) ) ); }
+
+    /**
+     * the scaled integer.
+     */
+    value_type value() const { return m_value; }
+
+    friend void swap( decimal & first, decimal & second )
+    {
+        using std::swap;
+        swap( first.m_value, second.m_value );
+    }
+
+    friend bool operator==( decimal const & x, decimal const & y ) { return x.m_value == y.m_value; }
+    friend bool operator!=( decimal const & x, decimal const & y ) { return x.m_value != y.m_value; }
+    friend bool operator< ( decimal const & x, decimal const & y ) { return x.m_value <  y.m_value; }
+    friend bool operator> ( decimal const & x, decimal const & y ) { return x.m_value >  y.m_value; }
+    friend bool operator<=( decimal const & x, decimal const & y ) { return x.m_value <= y.m_value; }
+    friend bool operator>=( decimal const & x, decimal const & y ) { return x.m_value >= y.m_value; }
+
+    decimal operator+() const { return *this; }
+    decimal operator-() const { return decimal( value_type( -m_value ) ); }
+
+    decimal & operator++() { m_value += one; return *this; }
+    decimal & operator--() { m_value -= one; return *this; }
+
+    decimal operator++( int ) { decimal tmp( *this ); ++*this; return tmp; }
+    decimal operator--( int ) { decimal tmp( *this ); --*this; return tmp; }
+
+    decimal & operator+=( decimal const & other ) { m_value += other.m_value; return *this; }
+    decimal & operator-=( decimal const & other ) { m_value -= other.m_value; return *this; }
+
+#ifndef WV_ALLOW_CONVERSION_FROM_UNDERLYING_TYPE_FOR_QUANTITY
+private:
+#endif
+    decimal & operator*=( value_type const n ) { m_value *= n; return *this; }
+    decimal & operator/=( value_type const n ) { return *this = *this / n; }
+    decimal & operator%=( value_type const n ) { return *this = *this % n; }
+
+public:
+    friend decimal operator+( decimal const & x, decimal const & y ) { return decimal( value_type( x.m_value + y.m_value ) ); }
+    friend decimal operator-( decimal const & x, decimal const & y ) { return decimal( value_type( x.m_value - y.m_value ) ); }
+
+    friend decimal operator*( decimal const & x, value_type const n ) { return decimal( value_type( x.m_value * n ) ); }
+    friend decimal operator*( value_type const n, decimal const & x ) { return decimal( value_type( n * x.m_value ) ); }
+
+    /**
+     * x / n, rounded.
+     */
+    friend decimal operator/( decimal const & x, value_type const n )
+    {
+        return decimal( detail::divide<Rounding>( x.m_value, n ) );
+    }
+
+    /**
+     * x - n * trunc( x / n ), as fmod().
+     */
+    friend decimal operator%( decimal const & x, value_type const n )
+    {
+        return decimal( value_type( x.m_value % value_type( n * one ) ) );
+    }
+
+    /**
+     * parse [+-]digits[.digits] in [first, last) into x; return the end of
+     * the number, or first if there is none or it does not fit. Decimals
+     * beyond Digits are rounded.
+     */
+    friend char const * parse( char const * const first, char const * const last, decimal & x )
+    {
+        unsigned_type const limit = unsigned_type( ~unsigned_type( 0 ) >> 1 );
+
+        char const * p = first;
+        bool const minus = p != last && *p == '-';
+        if ( p != last && ( *p == '-' || *p == '+' ) )
+            ++p;
+
+        char const * const digits_begin = p;
+        unsigned_type m = 0;
+
+        for ( ; p != last && unsigned( *p - '0' ) < 10; ++p )
+        {
+            unsigned const d = unsigned( *p - '0' );
+            if ( m > ( limit - d ) / 10 )
+                return first;
+            m = unsigned_type( m * 10 + d );
+        }
+
+        bool const integral = p != digits_begin;
+        int decimals = 0;
+        unsigned extra = 0;         // first digit beyond Digits
+        bool sticky = false;        // any nonzero digit after it
+
+        if ( p != last && *p == '.' )
+        {
+            char const * const point = p++;
+            for ( ; p != last && unsigned( *p - '0' ) < 10; ++p )
+            {
+                unsigned const d = unsigned( *p - '0' );
+                if ( decimals < Digits )
+                {
+                    if ( m > ( limit - d ) / 10 )
+                        return first;
+                    m = unsigned_type( m * 10 + d );
+                    ++decimals;
+                }
+                else if ( decimals++ == Digits )
+                    extra = d;
+                else
+                    sticky |= d != 0;
+            }
+            if ( !integral && p == point + 1 )
+                return first;
+        }
+        else if ( !integral )
+        {
+            return first;
+        }
+
+        for ( ; decimals < Digits; ++decimals )
+        {
+            if ( m > limit / 10 )
+                return first;
+            m = unsigned_type( m * 10 );
+        }
+
+        // round with the rest as remainder: ( 2 * extra + sticky ) / 20 compares to the half like extra.sticky / 10;
+        // the step away from zero depends on the parity of m only, so take it on m & 1, then check the range:
+        value_type const r = value_type( 2 * extra + sticky );
+        value_type const low = value_type( m & 1 );
+        m = unsigned_type( m + unsigned_type( minus ?
+            -low - Rounding::adjust( value_type( -low ), value_type( -r ), value_type( 20 ) ) :
+            Rounding::adjust( low, r, value_type( 20 ) ) - low ) );
+
+        if ( m > limit + unsigned_type( minus ) )
+            return first;
+
+        x = decimal( minus ? value_type( unsigned_type( -m ) ) : value_type( m ) );
+        return p;
+    }
+
+    /**
+     * write x as [-]digits.digits to out; return the end; out must hold
+     * max_chars characters.
+     */
+    friend char * format( decimal const & x, char * out )
+    {
+        unsigned_type m = x.m_value < 0 ? unsigned_type( -unsigned_type( x.m_value ) ) : unsigned_type( x.m_value );
+
+        char buffer[ max_chars ];
+        char * p = buffer + max_chars;
+
+        for ( int i = 0; i < Digits; ++i )
+        {
+            *--p = char( '0' + unsigned( m % 10 ) );
+            m /= 10;
+        }
+        if ( Digits > 0 )
+            *--p = '.';
+        do
+        {
+            *--p = char( '0' + unsigned( m % 10 ) );
+            m /= 10;
+        }
+        while ( m );
+
+        if ( x.m_value < 0 )
+            *out++ = '-';
+        while ( p != buffer + max_chars )
+            *out++ = *p++;
+        return out;
+    }
+
+    friend std::string to_string( decimal const & x )
+    {
+        char buffer[ max_chars ];
+        return std::string( buffer, format( x, buffer ) );
+    }
+
+    friend std::ostream & operator<<( std::ostream & os, decimal const & x )
+    {
+        char buffer[ max_chars ];
+        return os.write( buffer, format( x, buffer ) - buffer );
+    }
+
+private:
+    value_type m_value;
+};
+
+template< int D, typename TG, typename R, typename T >
+const int decimal<D,TG,R,T>::digits;
+
+template< int D, typename TG, typename R, typename T >
+const T decimal<D,TG,R,T>::one;
+
+template< int D, typename TG, typename R, typename T >
+const int decimal<D,TG,R,T>::max_chars;
+
+/**
+ * x * num / den, rounded, with a wide intermediate product.
+ */
+template< int D, typename TG, typename R, typename T >
+inline decimal<D,TG,R,T> scale( decimal<D,TG,R,T> const & x,
+    typename decimal<D,TG,R,T>::value_type const num, typename decimal<D,TG,R,T>::value_type const den )
+{
+    return decimal<D,TG,R,T>( detail::decimal_multiply_divide<R>( x.value(), num, den ) );
+}
+
+/**
+ * x * factor, rounded, for a decimal factor of any tag.
+ */
+template< int D, typename TG, typename R, typename T, int E, typename UG, typename S, typename U >
+inline decimal<D,TG,R,T> scale( decimal<D,TG,R,T> const & x, decimal<E,UG,S,U> const & factor )
+{
+    typedef typename std::conditional< ( sizeof( U ) > sizeof( T ) ), U, T >::type V;
+    return decimal<D,TG,R,T>( T( detail::decimal_multiply_divide<R>( V( x.value() ), V( factor.value() ), V( decimal<E,UG,S,U>::one ) ) ) );
+}
+
+/**
+ * return absolute value.
+ */
+template< int D, typename TG, typename R, typename T >
+inline decimal<D,TG,R,T> abs( decimal<D,TG,R,T> const & x )
+{
+    return x.value() < 0 ? -x : x;
+}
+
+/**
+ * scaled integer as underlying type, value rounded to integer (long), and
+ * value as real (double).
+ */
+template< int D, typename TG, typename R, typename T >
+inline T to_value( decimal<D,TG,R,T> const & x ) { return x.value(); }
+
+template< int D, typename TG, typename R, typename T >
+inline long to_integer( decimal<D,TG,R,T> const & x ) { return long( detail::divide<R>( x.value(), decimal<D,TG,R,T>::one ) ); }
+
+template< int D, typename TG, typename R, typename T >
+inline double to_real( decimal<D,TG,R,T> const & x ) { return double( x.value() ) / double( decimal<D,TG,R,T>::one ); }
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_DECIMAL_H_INCLUDED
+
+/*
+ * end of file
+ */
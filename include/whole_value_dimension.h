@@ -0,0 +1,193 @@
+/*
+ * whole_value_dimension.h
+ * quantities with compile-time dimensions: products and quotients.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * quantity<T, TG> allows no product or quotient of two quantities. With a
+ * tag dimension<E...>, the exponents of the base dimensions in a fixed
+ * order, it does: x * y and x / y add and subtract the exponent vectors
+ * and give the quantity with the resulting dimension, a quantity divided
+ * by one of the same dimension gives T, and a T divided by a quantity
+ * gives the inverse dimension. Addition, subtraction and comparison stay
+ * those of quantity, so they need the same dimension.
+ *
+ * Exponent vectors are kept without trailing zeros, so that a dimension
+ * has a single type: velocity is dimension<1, 0, -1>, and length is
+ * dimension<1>, not dimension<1, 0, 0>. make_dimension<E...> and
+ * WV_DEFINE_DIMENSION_TYPE() drop trailing zeros for you. The si
+ * namespace names the SI base dimensions in the order length, mass, time,
+ * current, temperature, amount and luminous intensity; any other order
+ * works as well, as long as it is used consistently.
+ *
+ * Everything is resolved at compile time: the operators are one inline
+ * multiply or divide of T and compile to the same code as raw arithmetic.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_DIMENSION_H_INCLUDED
+#define G_WV_WHOLE_VALUE_DIMENSION_H_INCLUDED
+
+#include "whole_value.h"
+
+#include <type_traits>
+
+/**
+ * create quantity type with dimension exponents ...
+ */
+#define WV_DEFINE_DIMENSION_TYPE( type_name, underlying_type, ... ) \
+    typedef ::wv::quantity<underlying_type, ::wv::make_dimension<__VA_ARGS__> > type_name;
+
+namespace wv {
+
+/**
+ * exponents of the base dimensions, without trailing zeros.
+ */
+template< int... E >
+struct dimension {};
+
+namespace detail {
+
+    /**
+     * dimension<E, R...>, or dimension<> for E = 0 and no R.
+     */
+    template< int E, typename R >
+    struct dimension_prepend;
+
+    template< int E >
+    struct dimension_prepend< E, dimension<> >
+    {
+        typedef typename std::conditional< E == 0, dimension<>, dimension<E> >::type type;
+    };
+
+    template< int E, int R0, int... R >
+    struct dimension_prepend< E, dimension<R0, R...> >
+    {
+        typedef dimension<E, R0, R...> type;
+    };
+
+    /**
+     * A + Sign * B, element by element, the shorter one extended with zeros.
+     */
+    template< typename A, typename B, int Sign >
+    struct dimension_add;
+
+    template< int Sign >
+    struct dimension_add< dimension<>, dimension<>, Sign >
+    {
+        typedef dimension<> type;
+    };
+
+    template< int A0, int... A, int Sign >
+    struct dimension_add< dimension<A0, A...>, dimension<>, Sign >
+    {
+        typedef typename dimension_prepend< A0, typename dimension_add< dimension<A...>, dimension<>, Sign >::type >::type type;
+    };
+
+    template< int B0, int... B, int Sign >
+    struct dimension_add< dimension<>, dimension<B0, B...>, Sign >
+    {
+        typedef typename dimension_prepend< Sign * B0, typename dimension_add< dimension<>, dimension<B...>, Sign >::type >::type type;
+    };
+
+    template< int A0, int... A, int B0, int... B, int Sign >
+    struct dimension_add< dimension<A0, A...>, dimension<B0, B...>, Sign >
+    {
+        typedef typename dimension_prepend< A0 + Sign * B0, typename dimension_add< dimension<A...>, dimension<B...>, Sign >::type >::type type;
+    };
+
+    /**
+     * quantity<T, D>, or T for the dimensionless D.
+     */
+    template< typename T, typename D >
+    struct dimension_quantity
+    {
+        typedef quantity<T, D> type;
+
+        static type make( T const value ) { return type( value ); }
+    };
+
+    template< typename T >
+    struct dimension_quantity< T, dimension<> >
+    {
+        typedef T type;
+
+        static type make( T const value ) { return value; }
+    };
+
+} // namespace detail
+
+/**
+ * dimension<E...> without trailing zeros.
+ */
+template< int... E >
+using make_dimension = typename detail::dimension_add< dimension<E...>, dimension<>, 1 >::type;
+
+/**
+ * dimensions of products and quotients.
+ */
+template< typename A, typename B >
+using dimension_product = typename detail::dimension_add< A, B, 1 >::type;
+
+template< typename A, typename B >
+using dimension_quotient = typename detail::dimension_add< A, B, -1 >::type;
+
+/**
+ * the SI base dimensions.
+ */
+namespace si {
+
+    typedef dimension<1>                   length;
+    typedef dimension<0, 1>                mass;
+    typedef dimension<0, 0, 1>             time;
+    typedef dimension<0, 0, 0, 1>          current;
+    typedef dimension<0, 0, 0, 0, 1>       temperature;
+    typedef dimension<0, 0, 0, 0, 0, 1>    amount;
+    typedef dimension<0, 0, 0, 0, 0, 0, 1> luminous_intensity;
+
+} // namespace si
+
+/**
+ * x * y, with the product of the dimensions.
+ */
+template< typename T, int... A, int... B >
+inline typename detail::dimension_quantity< T, dimension_product< dimension<A...>, dimension<B...> > >::type
+operator*( quantity< T, dimension<A...> > const & x, quantity< T, dimension<B...> > const & y )
+{
+    return detail::dimension_quantity< T, dimension_product< dimension<A...>, dimension<B...> > >::make( x.value() * y.value() );
+}
+
+/**
+ * x / y, with the quotient of the dimensions; T for equal dimensions.
+ */
+template< typename T, int... A, int... B >
+inline typename detail::dimension_quantity< T, dimension_quotient< dimension<A...>, dimension<B...> > >::type
+operator/( quantity< T, dimension<A...> > const & x, quantity< T, dimension<B...> > const & y )
+{
+    return detail::dimension_quantity< T, dimension_quotient< dimension<A...>, dimension<B...> > >::make( x.value() / y.value() );
+}
+
+/**
+ * x / y for a number x, with the inverse dimension of y.
+ */
+template< typename T, int... B >
+inline quantity< T, dimension_quotient< dimension<>, dimension<B...> > >
+operator/( typename quantity< T, dimension<B...> >::value_type const x, quantity< T, dimension<B...> > const & y )
+{
+    return quantity< T, dimension_quotient< dimension<>, dimension<B...> > >( x / y.value() );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_DIMENSION_H_INCLUDED
+
+/*
+ * end of file
+ */
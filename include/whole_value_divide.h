@@ -0,0 +1,345 @@
+/*
+ * whole_value_divide.h
+ * division by a run-time divisor without a divide instruction.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * divisor<T> precomputes, once, a multiplier and two shifts for an integral
+ * divisor d != 0 (after Granlund and Montgomery, as libdivide does), so that
+ * x / d becomes a high multiply, a subtraction, an addition and two shifts:
+ *
+ *   t = mulhi( x, magic ); q = ( t + ( ( x - t ) >> shift1 ) ) >> shift2
+ *
+ * This form is exact for every divisor including 1 and powers of two, so the
+ * computation does not branch on the divisor. Signed division divides the
+ * magnitudes and restores the sign, truncating toward zero like the built-in
+ * operator; min / -1 wraps to min. 8 and 16-bit types compute in 32 bits.
+ *
+ * x / d and x % d accept a divisor for quantity, arithmetic and built-in
+ * integers. divide() and remainder() process spans of whole values; for
+ * 32-bit underlying types with SSE2 they do four elements at a time, and
+ * otherwise a scalar loop without a divide instruction.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_DIVIDE_H_INCLUDED
+#define G_WV_WHOLE_VALUE_DIVIDE_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_fixed.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+# include <emmintrin.h>
+# define G_WV_HAVE_SSE2
+#endif
+
+namespace wv {
+
+template< typename T >
+class divisor;
+
+namespace detail {
+
+    /**
+     * unsigned type in which divisor<T> computes.
+     */
+    template< typename T >
+    struct divide_unsigned
+    {
+        typedef typename std::conditional< ( sizeof( T ) <= 4 ), uint32_t, uint64_t >::type type;
+    };
+
+    /**
+     * floor( hi * 2^N / d ) for hi < d and N the width of U.
+     */
+    template< typename U >
+    U divide_wide( U hi, U const d )
+    {
+        int const width = std::numeric_limits<U>::digits;
+
+        U q = 0;
+        for ( int i = 0; i < width; ++i )
+        {
+            U const carry = U( hi >> ( width - 1 ) );
+            hi = U( hi << 1 );
+            q = U( q << 1 );
+            if ( carry || hi >= d )
+            {
+                hi = U( hi - d );
+                q = U( q | 1u );
+            }
+        }
+        return q;
+    }
+
+    template< typename T >
+    struct divide_by;
+
+} // namespace detail
+
+/**
+ * precomputed run-time divisor.
+ */
+template< typename T >
+class divisor
+{
+    static_assert( std::is_integral<T>::value && !std::is_same<T, bool>::value, "divisor needs an integral type" );
+
+    typedef typename detail::divide_unsigned<T>::type U;
+
+    friend struct detail::divide_by<T>;
+
+    static const int width = std::numeric_limits<U>::digits;
+
+public:
+    typedef T value_type;
+
+    /**
+     * divisor d, d != 0.
+     */
+    explicit divisor( value_type const d )
+    : m_value( d )
+    , m_sign( sign_of( U( d ) ) )
+    {
+        assert( d != 0 && "divisor: division by zero" );
+
+        U const ud = U( U( U( d ) ^ m_sign ) - m_sign );
+
+        // l = ceil( log2( |d| ) ):
+        int l = 0;
+        while ( l < width && ( U( 1 ) << l ) < ud )
+            ++l;
+
+        U const hi = l == width ? U( -ud ) : U( ( U( 1 ) << l ) - ud );
+
+        m_magic = U( detail::divide_wide( hi, ud ) + 1u );
+        m_shift1 = l < 1 ? l : 1;
+        m_shift2 = l > 1 ? l - 1 : 0;
+    }
+
+    /**
+     * the divisor.
+     */
+    value_type value() const { return m_value; }
+
+    /**
+     * x / d, truncated toward zero.
+     */
+    value_type quotient( value_type const x ) const
+    {
+        U const sign = sign_of( U( x ) );
+        U const a = U( U( U( x ) ^ sign ) - sign );
+        U const t = detail::mulhi( a, m_magic );
+        U const q = U( U( t + U( U( a - t ) >> m_shift1 ) ) >> m_shift2 );
+        U const s = U( sign ^ m_sign );
+        return value_type( U( U( q ^ s ) - s ) );
+    }
+
+    /**
+     * x % d, with the sign of x.
+     */
+    value_type remainder( value_type const x ) const
+    {
+        return value_type( U( U( x ) - U( quotient( x ) ) * U( m_value ) ) );
+    }
+
+private:
+    /**
+     * all ones if x is negative as T, zero otherwise.
+     */
+    static U sign_of( U const x )
+    {
+        return std::numeric_limits<T>::is_signed ? U( -U( x >> ( width - 1 ) ) ) : U( 0 );
+    }
+
+    value_type m_value;
+    U m_sign;
+    U m_magic;
+    int m_shift1;
+    int m_shift2;
+};
+
+template< typename T >
+const int divisor<T>::width;
+
+namespace detail {
+
+    /**
+     * out[i] = a[i] / d or a[i] % d.
+     */
+    template< typename T >
+    struct divide_by
+    {
+        static void quotients( divisor<T> const & d, T const * const a, T * const out, std::size_t const n )
+        {
+            quotients( d, a, out, n, std::integral_constant< bool, sizeof( T ) == 4 >() );
+        }
+
+        static void remainders( divisor<T> const & d, T const * const a, T * const out, std::size_t const n )
+        {
+            remainders( d, a, out, n, std::integral_constant< bool, sizeof( T ) == 4 >() );
+        }
+
+    private:
+        static void quotients( divisor<T> const & d, T const * const a, T * const out, std::size_t const n, std::false_type )
+        {
+            for ( std::size_t i = 0; i < n; ++i )
+                out[i] = d.quotient( a[i] );
+        }
+
+        static void remainders( divisor<T> const & d, T const * const a, T * const out, std::size_t const n, std::false_type )
+        {
+            for ( std::size_t i = 0; i < n; ++i )
+                out[i] = d.remainder( a[i] );
+        }
+
+#ifdef G_WV_HAVE_SSE2
+        /**
+         * high halves of the products of the lanes of a with m, 32 bits.
+         */
+        static __m128i mulhi( __m128i const a, __m128i const m )
+        {
+            __m128i const even = _mm_srli_epi64( _mm_mul_epu32( a, m ), 32 );
+            __m128i const odd = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), m );
+            return _mm_or_si128( even, _mm_and_si128( odd, _mm_set_epi32( -1, 0, -1, 0 ) ) );
+        }
+
+        /**
+         * low halves of the products of the lanes of a with m, 32 bits.
+         */
+        static __m128i mullo( __m128i const a, __m128i const m )
+        {
+            __m128i const even = _mm_mul_epu32( a, m );
+            __m128i const odd = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), m );
+            return _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE( 0, 0, 2, 0 ) ), _mm_shuffle_epi32( odd, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+        }
+
+        /**
+         * divisor::quotient() on four lanes.
+         */
+        static __m128i quotient( divisor<T> const & d, __m128i const x )
+        {
+            __m128i const sign = std::numeric_limits<T>::is_signed ? _mm_srai_epi32( x, 31 ) : _mm_setzero_si128();
+            __m128i const a = _mm_sub_epi32( _mm_xor_si128( x, sign ), sign );
+            __m128i const t = mulhi( a, _mm_set1_epi32( int( d.m_magic ) ) );
+            __m128i const q = _mm_srl_epi32( _mm_add_epi32( t, _mm_srl_epi32( _mm_sub_epi32( a, t ), _mm_cvtsi32_si128( d.m_shift1 ) ) ), _mm_cvtsi32_si128( d.m_shift2 ) );
+            __m128i const s = _mm_xor_si128( sign, _mm_set1_epi32( int( d.m_sign ) ) );
+            return _mm_sub_epi32( _mm_xor_si128( q, s ), s );
+        }
+
+        static void quotients( divisor<T> const & d, T const * const a, T * const out, std::size_t const n, std::true_type )
+        {
+            std::size_t i = 0;
+            for ( ; i + 4 <= n; i += 4 )
+            {
+                __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const *>( a + i ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i *>( out + i ), quotient( d, x ) );
+            }
+            for ( ; i < n; ++i )
+                out[i] = d.quotient( a[i] );
+        }
+
+        static void remainders( divisor<T> const & d, T const * const a, T * const out, std::size_t const n, std::true_type )
+        {
+            __m128i const m = _mm_set1_epi32( int( d.m_value ) );
+
+            std::size_t i = 0;
+            for ( ; i + 4 <= n; i += 4 )
+            {
+                __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const *>( a + i ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i *>( out + i ), _mm_sub_epi32( x, mullo( quotient( d, x ), m ) ) );
+            }
+            for ( ; i < n; ++i )
+                out[i] = d.remainder( a[i] );
+        }
+#else
+        static void quotients( divisor<T> const & d, T const * const a, T * const out, std::size_t const n, std::true_type )
+        {
+            quotients( d, a, out, n, std::false_type() );
+        }
+
+        static void remainders( divisor<T> const & d, T const * const a, T * const out, std::size_t const n, std::true_type )
+        {
+            remainders( d, a, out, n, std::false_type() );
+        }
+#endif // G_WV_HAVE_SSE2
+    };
+
+} // namespace detail
+
+/**
+ * x / d and x % d for built-in integers.
+ */
+template< typename T >
+inline T operator/( T const x, divisor<T> const & d ) { return d.quotient( x ); }
+
+template< typename T >
+inline T operator%( T const x, divisor<T> const & d ) { return d.remainder( x ); }
+
+/**
+ * x / d and x % d for quantity.
+ */
+template< typename T, typename TG >
+inline quantity<T,TG> operator/( quantity<T,TG> const & x, divisor<T> const & d ) { return quantity<T,TG>( d.quotient( x.value() ) ); }
+
+template< typename T, typename TG >
+inline quantity<T,TG> operator%( quantity<T,TG> const & x, divisor<T> const & d ) { return quantity<T,TG>( d.remainder( x.value() ) ); }
+
+/**
+ * x / d and x % d for arithmetic.
+ */
+template< typename T, typename TG >
+inline arithmetic<T,TG> operator/( arithmetic<T,TG> const & x, divisor<T> const & d ) { return arithmetic<T,TG>( d.quotient( x.value() ) ); }
+
+template< typename T, typename TG >
+inline arithmetic<T,TG> operator%( arithmetic<T,TG> const & x, divisor<T> const & d ) { return arithmetic<T,TG>( d.remainder( x.value() ) ); }
+
+/**
+ * out[i] = a[i] / d; out may be a.
+ */
+template< typename Q >
+void divide( span<Q> const a, divisor< typename std::remove_const<Q>::type::value_type > const & d, span< typename std::remove_const<Q>::type > const out )
+{
+    typedef typename std::remove_const<Q>::type V;
+    typedef typename V::value_type T;
+
+    assert( a.size() == out.size() && "divide: different sizes" );
+
+    detail::divide_by<T>::quotients( d, values( span<V const>( a ) ).data(), values( out ).data(), a.size() );
+}
+
+/**
+ * out[i] = a[i] % d; out may be a.
+ */
+template< typename Q >
+void remainder( span<Q> const a, divisor< typename std::remove_const<Q>::type::value_type > const & d, span< typename std::remove_const<Q>::type > const out )
+{
+    typedef typename std::remove_const<Q>::type V;
+    typedef typename V::value_type T;
+
+    assert( a.size() == out.size() && "remainder: different sizes" );
+
+    detail::divide_by<T>::remainders( d, values( span<V const>( a ) ).data(), values( out ).data(), a.size() );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_DIVIDE_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,427 @@
+/*
+ * whole_value_filter.h
+ * selection masks and stream compaction over arrays of whole values.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * mask<Tag> holds one bit per row of a table, 64 rows per word. The tag names
+ * the table, not the value type: masks from predicates on the price and the
+ * quantity column of the same orders are both mask<Orders> and combine with
+ * &, | and ^, whereas a mask over another table does not compile.
+ *
+ * The select functions compare a span of whole values with a limit, blocks
+ * of 64 at a time: the comparison of a block is a loop without branches
+ * into 64 bytes, which the compiler vectorizes, and SSE2 packs those bytes
+ * into the mask word. Without SSE2 the packing is a plain loop.
+ *
+ * compact() copies the selected values to a new vector, compact_indices()
+ * yields the indices of the selected rows. Sparse words are visited per set
+ * bit, dense words are copied without branches.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_FILTER_H_INCLUDED
+#define G_WV_WHOLE_VALUE_FILTER_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+# include <emmintrin.h>
+# define G_WV_HAVE_SSE2
+#endif
+
+namespace wv {
+
+namespace detail {
+
+    inline unsigned popcount64( uint64_t const w )
+    {
+#if defined( __GNUC__ )
+        return static_cast<unsigned>( __builtin_popcountll( w ) );
+#else
+        uint64_t x = w - ( ( w >> 1 ) & 0x5555555555555555ULL );
+        x = ( x & 0x3333333333333333ULL ) + ( ( x >> 2 ) & 0x3333333333333333ULL );
+        x = ( x + ( x >> 4 ) ) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<unsigned>( ( x * 0x0101010101010101ULL ) >> 56 );
+#endif
+    }
+
+    inline unsigned lowest_bit64( uint64_t const w )
+    {
+#if defined( __GNUC__ )
+        return static_cast<unsigned>( __builtin_ctzll( w ) );
+#else
+        unsigned i = 0;
+        while ( !( w & ( uint64_t( 1 ) << i ) ) )
+            ++i;
+        return i;
+#endif
+    }
+
+    /**
+     * pack 64 bytes of 0 or 1 into a word, byte i into bit i.
+     */
+    inline uint64_t pack_bytes( uint8_t const * const b )
+    {
+#ifdef G_WV_HAVE_SSE2
+        uint64_t w = 0;
+        for ( unsigned j = 0; j < 4; ++j )
+        {
+            __m128i const v = _mm_loadu_si128( reinterpret_cast<__m128i const *>( b + 16 * j ) );
+            w |= uint64_t( unsigned( _mm_movemask_epi8( _mm_slli_epi64( v, 7 ) ) ) ) << ( 16 * j );
+        }
+        return w;
+#else
+        uint64_t w = 0;
+        for ( unsigned i = 0; i < 64; ++i )
+            w |= uint64_t( b[i] ) << i;
+        return w;
+#endif
+    }
+
+    struct less          { template< typename T > bool operator()( T const & x, T const & k ) const { return x <  k; } };
+    struct less_equal    { template< typename T > bool operator()( T const & x, T const & k ) const { return x <= k; } };
+    struct greater       { template< typename T > bool operator()( T const & x, T const & k ) const { return x >  k; } };
+    struct greater_equal { template< typename T > bool operator()( T const & x, T const & k ) const { return x >= k; } };
+    struct equal         { template< typename T > bool operator()( T const & x, T const & k ) const { return x == k; } };
+    struct not_equal     { template< typename T > bool operator()( T const & x, T const & k ) const { return x != k; } };
+
+} // namespace detail
+
+/**
+ * one bit per row of the table named by Tag.
+ */
+template< typename Tag >
+class mask
+{
+public:
+    typedef Tag tag_type;
+    typedef uint64_t word_type;
+    typedef std::size_t size_type;
+
+    static const size_type word_bits = 64;
+
+    mask() : m_size( 0 ) {}
+
+    /**
+     * n rows, all selected when x is true, none otherwise.
+     */
+    explicit mask( size_type const n, bool const x = false )
+    : m_words( words_for( n ), x ? ~word_type( 0 ) : word_type( 0 ) ), m_size( n )
+    {
+        clear_tail();
+    }
+
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    bool test( size_type const i ) const
+    {
+        assert( i < m_size );
+        return ( m_words[ i / word_bits ] >> ( i % word_bits ) ) & 1;
+    }
+
+    bool operator[]( size_type const i ) const { return test( i ); }
+
+    void set( size_type const i, bool const x = true )
+    {
+        assert( i < m_size );
+        word_type const bit = word_type( 1 ) << ( i % word_bits );
+        word_type & w = m_words[ i / word_bits ];
+        w = x ? w | bit : w & ~bit;
+    }
+
+    void reset( size_type const i ) { set( i, false ); }
+
+    /**
+     * number of selected rows.
+     */
+    size_type count() const
+    {
+        size_type n = 0;
+        for ( size_type i = 0; i < m_words.size(); ++i )
+            n += detail::popcount64( m_words[i] );
+        return n;
+    }
+
+    bool any() const
+    {
+        for ( size_type i = 0; i < m_words.size(); ++i )
+            if ( m_words[i] )
+                return true;
+        return false;
+    }
+
+    bool none() const { return !any(); }
+
+    /**
+     * call f( i ) for every selected row i, in increasing order.
+     */
+    template< typename F >
+    void for_each( F f ) const
+    {
+        for ( size_type k = 0; k < m_words.size(); ++k )
+            for ( word_type w = m_words[k]; w; w &= w - 1 )
+                f( k * word_bits + detail::lowest_bit64( w ) );
+    }
+
+    /**
+     * the mask words; bits beyond size() are zero.
+     */
+    span<word_type> words() { return make_span( m_words ); }
+    span<word_type const> words() const { return make_span( m_words ); }
+
+    mask & operator&=( mask const & other ) { return combine( other, op_and() ); }
+    mask & operator|=( mask const & other ) { return combine( other, op_or() ); }
+    mask & operator^=( mask const & other ) { return combine( other, op_xor() ); }
+
+    mask operator~() const
+    {
+        mask r( *this );
+        for ( size_type i = 0; i < r.m_words.size(); ++i )
+            r.m_words[i] = ~r.m_words[i];
+        r.clear_tail();
+        return r;
+    }
+
+    friend mask operator&( mask x, mask const & y ) { return x &= y; }
+    friend mask operator|( mask x, mask const & y ) { return x |= y; }
+    friend mask operator^( mask x, mask const & y ) { return x ^= y; }
+
+    friend bool operator==( mask const & x, mask const & y ) { return x.m_size == y.m_size && x.m_words == y.m_words; }
+    friend bool operator!=( mask const & x, mask const & y ) { return !( x == y ); }
+
+    void swap( mask & other )
+    {
+        m_words.swap( other.m_words );
+        std::swap( m_size, other.m_size );
+    }
+
+    friend void swap( mask & first, mask & second )
+    {
+        first.swap( second );
+    }
+
+private:
+    struct op_and { word_type operator()( word_type x, word_type y ) const { return x & y; } };
+    struct op_or  { word_type operator()( word_type x, word_type y ) const { return x | y; } };
+    struct op_xor { word_type operator()( word_type x, word_type y ) const { return x ^ y; } };
+
+    static size_type words_for( size_type const n ) { return ( n + word_bits - 1 ) / word_bits; }
+
+    template< typename Op >
+    mask & combine( mask const & other, Op op )
+    {
+        assert( m_size == other.m_size && "mask: different number of rows" );
+
+        word_type * const p = m_words.data();
+        word_type const * const q = other.m_words.data();
+
+        for ( size_type i = 0; i < m_words.size(); ++i )
+            p[i] = op( p[i], q[i] );
+        return *this;
+    }
+
+    void clear_tail()
+    {
+        if ( m_size % word_bits )
+            m_words.back() &= ( word_type( 1 ) << ( m_size % word_bits ) ) - 1;
+    }
+
+    std::vector<word_type> m_words;
+    size_type m_size;
+};
+
+template< typename Tag >
+const typename mask<Tag>::size_type mask<Tag>::word_bits;
+
+/**
+ * mask of the rows whose underlying value x satisfies pred( x ).
+ */
+template< typename Tag, typename Q, typename Pred >
+mask<Tag> select_if( span<Q> const a, Pred pred )
+{
+    typedef typename Q::value_type T;
+
+    T const * const p = values( span<Q const>( a ) ).data();
+    std::size_t const n = a.size();
+
+    mask<Tag> m( n );
+    uint64_t * const w = m.words().data();
+
+    std::size_t const full = n / 64;
+
+    for ( std::size_t k = 0; k < full; ++k )
+    {
+        T const * const q = p + 64 * k;
+        uint8_t b[64];
+
+        for ( unsigned i = 0; i < 64; ++i )
+            b[i] = pred( q[i] );
+
+        w[k] = detail::pack_bytes( b );
+    }
+
+    for ( std::size_t i = 64 * full; i < n; ++i )
+        if ( pred( p[i] ) )
+            w[ i / 64 ] |= uint64_t( 1 ) << ( i % 64 );
+
+    return m;
+}
+
+namespace detail {
+
+    template< typename T, typename Cmp >
+    struct compare_with
+    {
+        compare_with( T const & k ) : limit( k ) {}
+        bool operator()( T const & x ) const { return Cmp()( x, limit ); }
+        T limit;
+    };
+
+    template< typename Q >
+    struct limit_of
+    {
+        typedef typename std::remove_const<Q>::type const & type;
+    };
+
+    template< typename Tag, typename Cmp, typename Q >
+    mask<Tag> select_cmp( span<Q> const a, typename limit_of<Q>::type limit )
+    {
+        return select_if<Tag>( a, compare_with< typename Q::value_type, Cmp >( limit.value() ) );
+    }
+
+} // namespace detail
+
+/**
+ * mask of the rows with value less than, less than or equal to, greater than,
+ * greater than or equal to, equal to, or unequal to limit.
+ */
+template< typename Tag, typename Q >
+mask<Tag> select_less( span<Q> const a, typename detail::limit_of<Q>::type limit ) { return detail::select_cmp<Tag, detail::less>( a, limit ); }
+
+template< typename Tag, typename Q >
+mask<Tag> select_less_equal( span<Q> const a, typename detail::limit_of<Q>::type limit ) { return detail::select_cmp<Tag, detail::less_equal>( a, limit ); }
+
+template< typename Tag, typename Q >
+mask<Tag> select_greater( span<Q> const a, typename detail::limit_of<Q>::type limit ) { return detail::select_cmp<Tag, detail::greater>( a, limit ); }
+
+template< typename Tag, typename Q >
+mask<Tag> select_greater_equal( span<Q> const a, typename detail::limit_of<Q>::type limit ) { return detail::select_cmp<Tag, detail::greater_equal>( a, limit ); }
+
+template< typename Tag, typename Q >
+mask<Tag> select_equal( span<Q> const a, typename detail::limit_of<Q>::type limit ) { return detail::select_cmp<Tag, detail::equal>( a, limit ); }
+
+template< typename Tag, typename Q >
+mask<Tag> select_not_equal( span<Q> const a, typename detail::limit_of<Q>::type limit ) { return detail::select_cmp<Tag, detail::not_equal>( a, limit ); }
+
+/**
+ * the selected values, in row order.
+ */
+template< typename Tag, typename Q >
+std::vector< typename std::remove_const<Q>::type > compact( span<Q> const a, mask<Tag> const & m )
+{
+    typedef typename std::remove_const<Q>::type V;
+    typedef typename V::value_type T;
+
+    assert( a.size() == m.size() && "compact: different number of rows" );
+
+    std::size_t const count = m.count();
+
+    // slack for the stores past the last selected value in a dense word:
+    std::vector<V> out( count + 64 );
+
+    T const * const p = values( span<V const>( a ) ).data();
+    T * const dst = values( make_span( out ) ).data();
+    span<uint64_t const> const w = m.words();
+
+    std::size_t j = 0;
+    for ( std::size_t k = 0; k < w.size(); ++k )
+    {
+        uint64_t const bits = w[k];
+        T const * const q = p + 64 * k;
+
+        if ( detail::popcount64( bits ) >= 32 && 64 * k + 64 <= a.size() )
+        {
+            // dense: store every value, advance over the selected ones only.
+            for ( unsigned i = 0; i < 64; ++i )
+            {
+                dst[j] = q[i];
+                j += ( bits >> i ) & 1;
+            }
+        }
+        else
+        {
+            for ( uint64_t b = bits; b; b &= b - 1 )
+                dst[ j++ ] = q[ detail::lowest_bit64( b ) ];
+        }
+    }
+
+    out.resize( count );
+    return out;
+}
+
+/**
+ * the indices of the selected rows, in increasing order.
+ */
+template< typename Index = std::size_t, typename Tag >
+std::vector<Index> compact_indices( mask<Tag> const & m )
+{
+    std::size_t const count = m.count();
+    std::vector<Index> out( count + 64 );
+    Index * const dst = out.data();
+
+    span<uint64_t const> const w = m.words();
+
+    std::size_t j = 0;
+    for ( std::size_t k = 0; k < w.size(); ++k )
+    {
+        uint64_t const bits = w[k];
+
+        if ( detail::popcount64( bits ) >= 32 )
+        {
+            for ( unsigned i = 0; i < 64; ++i )
+            {
+                dst[j] = Index( 64 * k + i );
+                j += ( bits >> i ) & 1;
+            }
+        }
+        else
+        {
+            for ( uint64_t b = bits; b; b &= b - 1 )
+                dst[ j++ ] = Index( 64 * k + detail::lowest_bit64( b ) );
+        }
+    }
+
+    out.resize( count );
+    return out;
+}
+
+template< typename Tag, typename Q, typename A >
+std::vector<Q> compact( std::vector<Q,A> const & a, mask<Tag> const & m )
+{
+    return compact( make_span( a ), m );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_FILTER_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,408 @@
+/*
+ * whole_value_fixed.h
+ * binary fixed-point quantity type with a compile-time scale.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * fixed<T, FracBits, TG, Rounding> represents value() / 2^FracBits with a
+ * signed integral T; value() is the scaled integer, so a span of fixed
+ * values is a span of plain integers to the bulk kernels. The operations
+ * are those of quantity: comparison, + and - of fixed values, and scaling
+ * by an integer. Addition, subtraction and multiplication by an integer are
+ * exact; division rounds after the Rounding policy:
+ * - round_toward_zero:     like integer division,
+ * - round_down:            toward minus infinity,
+ * - round_to_nearest:      halves away from zero,
+ * - round_to_nearest_even: halves to the even neighbour (banker's rounding).
+ *
+ * scale() multiplies by a rational factor or by another fixed value (of any
+ * tag) in a wider integer and rounds likewise; with 64-bit T this needs
+ * __int128 (GCC, Clang). to_integer() rounds, to_real() is exact for
+ * values that fit a double.
+ *
+ * The class is a single integer without user-declared copy operations, so
+ * loops over fixed values vectorize as loops over T do. Rounding by a
+ * power of two uses an arithmetic right shift of negative values, which
+ * all supported compilers provide.
+ *
+ * Use WV_DEFINE_FIXED_TYPE() to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_FIXED_H_INCLUDED
+#define G_WV_WHOLE_VALUE_FIXED_H_INCLUDED
+
+#include "whole_value.h"
+
+#include <cmath>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+/**
+ * create fixed-point value type.
+ */
+#define WV_DEFINE_FIXED_TYPE( type_name, underlying_type, frac_bits, rounding ) \
+    struct type_name##_tag{}; \
+    typedef ::wv::fixed<underlying_type, frac_bits, type_name##_tag, rounding> type_name;
+
+#if defined( __SIZEOF_INT128__ )
+# define G_WV_HAVE_INT128
+#endif
+
+namespace wv {
+
+#ifdef G_WV_HAVE_INT128
+/**
+ * 128-bit integers, where the compiler provides them.
+ */
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+namespace detail {
+
+    /**
+     * integer type to hold products of two T; none for 64-bit T without __int128.
+     */
+    template< typename T, bool Narrow = ( sizeof( T ) <= 4 ) >
+    struct fixed_wide;
+
+    template< typename T >
+    struct fixed_wide< T, true >
+    {
+        typedef int64_t type;
+    };
+
+#ifdef G_WV_HAVE_INT128
+    template< typename T >
+    struct fixed_wide< T, false >
+    {
+        typedef int128_t type;
+    };
+#endif
+
+    /**
+     * high half of the double width product a * b.
+     */
+    inline uint32_t mulhi( uint32_t const a, uint32_t const b )
+    {
+        return uint32_t( ( uint64_t( a ) * b ) >> 32 );
+    }
+
+    inline uint64_t mulhi( uint64_t const a, uint64_t const b )
+    {
+#ifdef G_WV_HAVE_INT128
+        return uint64_t( ( uint128_t( a ) * b ) >> 64 );
+#else
+        uint64_t const a0 = uint32_t( a ), a1 = a >> 32;
+        uint64_t const b0 = uint32_t( b ), b1 = b >> 32;
+        uint64_t const p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        uint64_t const middle = ( p00 >> 32 ) + uint32_t( p01 ) + uint32_t( p10 );
+        return p11 + ( p01 >> 32 ) + ( p10 >> 32 ) + ( middle >> 32 );
+#endif
+    }
+
+    template< typename W >
+    bool negative( W const x )
+    {
+        return x < W( 0 );
+    }
+
+    /**
+     * |r| compared with |d| - |r|: whether q = num / den is at or past the half.
+     */
+    template< typename W >
+    int compare_half( W const r, W const d )
+    {
+        W const ar = negative( r ) ? W( -r ) : r;
+        W const ad = negative( d ) ? W( -d ) : d;
+        return ar < ad - ar ? -1 : ar > ad - ar ? 1 : 0;
+    }
+
+    /**
+     * one away from zero, in the direction of num / den, given remainder r != 0.
+     */
+    template< typename W >
+    W away( W const r, W const d )
+    {
+        return negative( W( r ^ d ) ) ? W( -1 ) : W( 1 );
+    }
+
+} // namespace detail
+
+/**
+ * rounding policy: toward zero.
+ */
+struct round_toward_zero
+{
+    /**
+     * x / 2^n.
+     */
+    template< typename W >
+    static W shift( W const x, int const n )
+    {
+        W const mask = W( ( W( 1 ) << n ) - 1 );
+        return W( ( x + ( W( -W( detail::negative( x ) ) ) & mask ) ) >> n );
+    }
+
+    /**
+     * the rounded quotient from the truncated quotient q and remainder r of
+     * the division by d.
+     */
+    template< typename W >
+    static W adjust( W const q, W const, W const )
+    {
+        return q;
+    }
+};
+
+/**
+ * rounding policy: toward minus infinity.
+ */
+struct round_down
+{
+    template< typename W >
+    static W shift( W const x, int const n )
+    {
+        return W( x >> n );
+    }
+
+    template< typename W >
+    static W adjust( W const q, W const r, W const d )
+    {
+        return W( q - W( r != 0 && detail::negative( W( r ^ d ) ) ) );
+    }
+};
+
+/**
+ * rounding policy: to nearest, halves away from zero.
+ */
+struct round_to_nearest
+{
+    template< typename W >
+    static W shift( W const x, int const n )
+    {
+        W const half = W( W( 1 ) << n >> 1 );
+        return n ? W( ( x + half - W( detail::negative( x ) ) ) >> n ) : x;
+    }
+
+    template< typename W >
+    static W adjust( W const q, W const r, W const d )
+    {
+        return r != 0 && detail::compare_half( r, d ) >= 0 ? W( q + detail::away( r, d ) ) : q;
+    }
+};
+
+/**
+ * rounding policy: to nearest, halves to even.
+ */
+struct round_to_nearest_even
+{
+    template< typename W >
+    static W shift( W const x, int const n )
+    {
+        W const half = W( W( 1 ) << n >> 1 );
+        return n ? W( ( x + half - 1 + ( ( x >> n ) & 1 ) ) >> n ) : x;
+    }
+
+    template< typename W >
+    static W adjust( W const q, W const r, W const d )
+    {
+        if ( r == 0 )
+            return q;
+        int const c = detail::compare_half( r, d );
+        return c > 0 || ( c == 0 && ( q & 1 ) ) ? W( q + detail::away( r, d ) ) : q;
+    }
+};
+
+namespace detail {
+
+    /**
+     * num / den, rounded after Rounding.
+     */
+    template< typename Rounding, typename W >
+    W divide( W const num, W const den )
+    {
+        return Rounding::adjust( W( num / den ), W( num % den ), den );
+    }
+
+    /**
+     * x * num / den, rounded, with the product in W; divides in T when the
+     * product fits, as a wide division is a slow library call.
+     */
+    template< typename Rounding, typename W, typename T >
+    T multiply_divide( T const x, T const num, T const den )
+    {
+        W const product = W( W( x ) * W( num ) );
+        if ( product >= W( std::numeric_limits<T>::min() ) && product <= W( std::numeric_limits<T>::max() ) )
+            return divide<Rounding>( T( product ), den );
+        return T( divide<Rounding>( product, W( den ) ) );
+    }
+
+} // namespace detail
+
+/**
+ * fixed-point quantity: value() / 2^FracBits.
+ */
+template< typename T, int FracBits, typename TG, typename Rounding = round_to_nearest >
+class fixed
+{
+    static_assert( std::is_integral<T>::value && std::is_signed<T>::value, "fixed needs a signed integral underlying type" );
+    static_assert( FracBits >= 0 && FracBits < std::numeric_limits<T>::digits, "fixed: FracBits out of range" );
+
+public:
+    typedef T value_type;
+    typedef Rounding rounding_type;
+
+    static const int frac_bits = FracBits;
+
+    /**
+     * the scaled integer of 1.
+     */
+    static const T one = T( T( 1 ) << FracBits );
+
+    fixed() : m_value( value_type() ) {}
+
+    /**
+     * from the scaled integer.
+     */
+    explicit fixed( value_type const value ) : m_value( value ) {}
+
+    /**
+     * from an integer, exact if it fits.
+     */
+    static fixed from_integer( value_type const n ) { return fixed( value_type( n * one ) ); }
+
+    /**
+     * from a double, rounded to nearest.
+     */
+    static fixed from_real( double const x ) { return fixed( value_type( std::llround( std::ldexp( x, FracBits ) ) ) ); }
+
+    /**
+     * the scaled integer.
+     */
+    value_type value() const { return m_value; }
+
+    friend void swap( fixed & first, fixed & second )
+    {
+        using std::swap;
+        swap( first.m_value, second.m_value );
+    }
+
+    friend bool operator==( fixed const & x, fixed const & y ) { return x.m_value == y.m_value; }
+    friend bool operator!=( fixed const & x, fixed const & y ) { return x.m_value != y.m_value; }
+    friend bool operator< ( fixed const & x, fixed const & y ) { return x.m_value <  y.m_value; }
+    friend bool operator> ( fixed const & x, fixed const & y ) { return x.m_value >  y.m_value; }
+    friend bool operator<=( fixed const & x, fixed const & y ) { return x.m_value <= y.m_value; }
+    friend bool operator>=( fixed const & x, fixed const & y ) { return x.m_value >= y.m_value; }
+
+    fixed operator+() const { return *this; }
+    fixed operator-() const { return fixed( value_type( -m_value ) ); }
+
+    fixed & operator++() { m_value += one; return *this; }
+    fixed & operator--() { m_value -= one; return *this; }
+
+    fixed operator++( int ) { fixed tmp( *this ); ++*this; return tmp; }
+    fixed operator--( int ) { fixed tmp( *this ); --*this; return tmp; }
+
+    fixed & operator+=( fixed const & other ) { m_value += other.m_value; return *this; }
+    fixed & operator-=( fixed const & other ) { m_value -= other.m_value; return *this; }
+
+#ifndef WV_ALLOW_CONVERSION_FROM_UNDERLYING_TYPE_FOR_QUANTITY
+private:
+#endif
+    fixed & operator*=( value_type const n ) { m_value *= n; return *this; }
+    fixed & operator/=( value_type const n ) { return *this = *this / n; }
+    fixed & operator%=( value_type const n ) { return *this = *this % n; }
+
+public:
+    friend fixed operator+( fixed const & x, fixed const & y ) { return fixed( value_type( x.m_value + y.m_value ) ); }
+    friend fixed operator-( fixed const & x, fixed const & y ) { return fixed( value_type( x.m_value - y.m_value ) ); }
+
+    friend fixed operator*( fixed const & x, value_type const n ) { return fixed( value_type( x.m_value * n ) ); }
+    friend fixed operator*( value_type const n, fixed const & x ) { return fixed( value_type( n * x.m_value ) ); }
+
+    /**
+     * x / n, rounded.
+     */
+    friend fixed operator/( fixed const & x, value_type const n )
+    {
+        return fixed( detail::divide<Rounding>( x.m_value, n ) );
+    }
+
+    /**
+     * x - n * trunc( x / n ), as fmod().
+     */
+    friend fixed operator%( fixed const & x, value_type const n )
+    {
+        return fixed( value_type( x.m_value % value_type( n * one ) ) );
+    }
+
+private:
+    value_type m_value;
+};
+
+template< typename T, int F, typename TG, typename R >
+const int fixed<T,F,TG,R>::frac_bits;
+
+template< typename T, int F, typename TG, typename R >
+const T fixed<T,F,TG,R>::one;
+
+/**
+ * x * num / den, rounded, with a wide intermediate product.
+ */
+template< typename T, int F, typename TG, typename R >
+inline fixed<T,F,TG,R> scale( fixed<T,F,TG,R> const & x,
+    typename fixed<T,F,TG,R>::value_type const num, typename fixed<T,F,TG,R>::value_type const den )
+{
+    return fixed<T,F,TG,R>( detail::multiply_divide< R, typename detail::fixed_wide<T>::type >( x.value(), num, den ) );
+}
+
+/**
+ * x * factor, rounded, for a fixed factor of any tag.
+ */
+template< typename T, int F, typename TG, typename R, typename U, int G, typename UG, typename S >
+inline fixed<T,F,TG,R> scale( fixed<T,F,TG,R> const & x, fixed<U,G,UG,S> const & factor )
+{
+    typedef typename detail::fixed_wide< typename std::conditional< ( sizeof( U ) > sizeof( T ) ), U, T >::type >::type W;
+    return fixed<T,F,TG,R>( T( R::shift( W( W( x.value() ) * W( factor.value() ) ), G ) ) );
+}
+
+/**
+ * return absolute value.
+ */
+template< typename T, int F, typename TG, typename R >
+inline fixed<T,F,TG,R> abs( fixed<T,F,TG,R> const & x )
+{
+    return x.value() < 0 ? -x : x;
+}
+
+/**
+ * scaled integer as underlying type, value rounded to integer (long), and
+ * value as real (double).
+ */
+template< typename T, int F, typename TG, typename R >
+inline T to_value( fixed<T,F,TG,R> const & x ) { return x.value(); }
+
+template< typename T, int F, typename TG, typename R >
+inline long to_integer( fixed<T,F,TG,R> const & x ) { return long( R::shift( x.value(), F ) ); }
+
+template< typename T, int F, typename TG, typename R >
+inline double to_real( fixed<T,F,TG,R> const & x ) { return std::ldexp( double( x.value() ), -F ); }
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_FIXED_H_INCLUDED
+
+/*
+ * end of file
+ */
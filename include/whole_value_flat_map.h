@@ -0,0 +1,338 @@
+/*
+ * whole_value_flat_map.h
+ * open-addressing hash map for whole value keys.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * flat_map<Key, V> keeps one control byte per slot in groups of 16. A full
+ * slot's control byte holds 7 bits of the key's hash, so a probe compares a
+ * whole group of 16 control bytes against the hash in one SSE2 instruction
+ * and only touches the keys whose bits match. Keys and values are kept in
+ * separate arrays: probing reads control bytes and sizeof(Key) keys, never
+ * the values. Without SSE2 the group compare is a plain loop.
+ *
+ * Key and V must be default constructible; free slots hold default values.
+ * An erased slot becomes a tombstone until the next rehash. The table grows
+ * when full and tombstone slots exceed 7/8 of the capacity.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_FLAT_MAP_H_INCLUDED
+#define G_WV_WHOLE_VALUE_FLAT_MAP_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_hash.h"
+
+#include <cstddef>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+# include <emmintrin.h>
+# define G_WV_HAVE_SSE2
+#endif
+
+namespace wv {
+
+namespace detail {
+
+    static const int8_t ctrl_empty   = -128;   // 0b10000000
+    static const int8_t ctrl_deleted = -2;     // 0b11111110
+
+    /**
+     * bit i set for each control byte i of a group of 16 that equals h.
+     */
+    inline unsigned group_match( int8_t const * const g, int8_t const h )
+    {
+#ifdef G_WV_HAVE_SSE2
+        __m128i const group = _mm_loadu_si128( reinterpret_cast<__m128i const *>( g ) );
+        return static_cast<unsigned>( _mm_movemask_epi8( _mm_cmpeq_epi8( group, _mm_set1_epi8( h ) ) ) );
+#else
+        unsigned m = 0;
+        for ( int i = 0; i < 16; ++i )
+            m |= unsigned( g[i] == h ) << i;
+        return m;
+#endif
+    }
+
+    /**
+     * bit i set for each control byte i that is empty or deleted.
+     */
+    inline unsigned group_match_free( int8_t const * const g )
+    {
+#ifdef G_WV_HAVE_SSE2
+        __m128i const group = _mm_loadu_si128( reinterpret_cast<__m128i const *>( g ) );
+        return static_cast<unsigned>( _mm_movemask_epi8( group ) );
+#else
+        unsigned m = 0;
+        for ( int i = 0; i < 16; ++i )
+            m |= unsigned( g[i] < 0 ) << i;
+        return m;
+#endif
+    }
+
+    inline unsigned lowest_bit( unsigned const m )
+    {
+#if defined( __GNUC__ )
+        return static_cast<unsigned>( __builtin_ctz( m ) );
+#else
+        unsigned i = 0;
+        while ( !( m & ( 1u << i ) ) )
+            ++i;
+        return i;
+#endif
+    }
+
+} // namespace detail
+
+/**
+ * open-addressing hash map with SIMD group probing.
+ */
+template< typename Key, typename V, typename Hash = wv::hash<Key>, typename Equal = wv::equal_to<Key> >
+class flat_map
+{
+public:
+    typedef Key key_type;
+    typedef V mapped_type;
+    typedef std::size_t size_type;
+
+    static const size_type group_size = 16;
+
+    flat_map() : m_size( 0 ), m_used( 0 ) {}
+
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_type capacity() const { return m_keys.size(); }
+
+    /**
+     * make room for n elements without rehashing.
+     */
+    void reserve( size_type const n )
+    {
+        size_type cap = group_size;
+        while ( cap * 7 / 8 < n )
+            cap *= 2;
+
+        if ( cap > capacity() )
+            rehash( cap );
+    }
+
+    void clear()
+    {
+        flat_map().swap( *this );
+    }
+
+    /**
+     * pointer to the value of k, null if absent.
+     */
+    V * find( Key const & k )
+    {
+        size_type const i = find_index( k );
+        return i != npos ? &m_values[i] : 0;
+    }
+
+    V const * find( Key const & k ) const
+    {
+        size_type const i = find_index( k );
+        return i != npos ? &m_values[i] : 0;
+    }
+
+    bool contains( Key const & k ) const
+    {
+        return find_index( k ) != npos;
+    }
+
+    /**
+     * insert (k, v) if k is absent; return the value of k and whether it was inserted.
+     */
+    std::pair<V *, bool> insert( Key const & k, V const & v )
+    {
+        std::size_t const h = m_hash( k );
+        size_type i = find_index( k, h );
+
+        if ( i != npos )
+            return std::pair<V *, bool>( &m_values[i], false );
+
+        i = insert_index( h );
+        m_keys[i] = k;
+        m_values[i] = v;
+        return std::pair<V *, bool>( &m_values[i], true );
+    }
+
+    /**
+     * value of k, default constructed if absent.
+     */
+    V & operator[]( Key const & k )
+    {
+        return *insert( k, V() ).first;
+    }
+
+    /**
+     * remove k; false if absent.
+     */
+    bool erase( Key const & k )
+    {
+        size_type const i = find_index( k );
+
+        if ( i == npos )
+            return false;
+
+        set_ctrl( i, detail::ctrl_deleted );
+        m_keys[i] = Key();
+        m_values[i] = V();
+        --m_size;
+        return true;
+    }
+
+    /**
+     * call f( key, value ) for every element.
+     */
+    template< typename F >
+    void for_each( F f )
+    {
+        for ( size_type i = 0; i < capacity(); ++i )
+            if ( m_ctrl[i] >= 0 )
+                f( static_cast<Key const &>( m_keys[i] ), m_values[i] );
+    }
+
+    template< typename F >
+    void for_each( F f ) const
+    {
+        for ( size_type i = 0; i < capacity(); ++i )
+            if ( m_ctrl[i] >= 0 )
+                f( m_keys[i], m_values[i] );
+    }
+
+    void swap( flat_map & other )
+    {
+        m_ctrl.swap( other.m_ctrl );
+        m_keys.swap( other.m_keys );
+        m_values.swap( other.m_values );
+        std::swap( m_size, other.m_size );
+        std::swap( m_used, other.m_used );
+    }
+
+    friend void swap( flat_map & first, flat_map & second )
+    {
+        first.swap( second );
+    }
+
+private:
+    static const size_type npos = ~size_type( 0 );
+
+    static int8_t h2( std::size_t const h ) { return static_cast<int8_t>( h & 0x7f ); }
+    static std::size_t h1( std::size_t const h ) { return h >> 7; }
+
+    size_type group_mask() const { return capacity() / group_size - 1; }
+
+    size_type find_index( Key const & k ) const
+    {
+        return find_index( k, m_hash( k ) );
+    }
+
+    size_type find_index( Key const & k, std::size_t const h ) const
+    {
+        if ( m_size == 0 )
+            return npos;
+
+        int8_t const tag = h2( h );
+        size_type g = h1( h ) & group_mask();
+
+        for ( size_type step = 1; ; ++step )
+        {
+            int8_t const * const ctrl = &m_ctrl[ g * group_size ];
+
+            for ( unsigned m = detail::group_match( ctrl, tag ); m; m &= m - 1 )
+            {
+                size_type const i = g * group_size + detail::lowest_bit( m );
+                if ( m_equal( m_keys[i], k ) )
+                    return i;
+            }
+
+            if ( detail::group_match( ctrl, detail::ctrl_empty ) )
+                return npos;
+
+            g = ( g + step ) & group_mask();
+        }
+    }
+
+    /**
+     * slot for a new key with hash h; grows the table if needed.
+     */
+    size_type insert_index( std::size_t const h )
+    {
+        if ( ( m_used + 1 ) > capacity() * 7 / 8 )
+            rehash( m_size + 1 > capacity() * 7 / 16 ? 2 * capacity() : capacity() );
+
+        size_type g = h1( h ) & group_mask();
+
+        for ( size_type step = 1; ; ++step )
+        {
+            unsigned const m = detail::group_match_free( &m_ctrl[ g * group_size ] );
+
+            if ( m )
+            {
+                size_type const i = g * group_size + detail::lowest_bit( m );
+
+                if ( m_ctrl[i] == detail::ctrl_empty )
+                    ++m_used;
+
+                set_ctrl( i, h2( h ) );
+                ++m_size;
+                return i;
+            }
+            g = ( g + step ) & group_mask();
+        }
+    }
+
+    void set_ctrl( size_type const i, int8_t const c )
+    {
+        m_ctrl[i] = c;
+    }
+
+    void rehash( size_type cap )
+    {
+        if ( cap < group_size )
+            cap = group_size;
+
+        flat_map next;
+        next.m_ctrl.assign( cap, detail::ctrl_empty );
+        next.m_keys.resize( cap );
+        next.m_values.resize( cap );
+
+        for ( size_type i = 0; i < capacity(); ++i )
+        {
+            if ( m_ctrl[i] >= 0 )
+            {
+                size_type const j = next.insert_index( m_hash( m_keys[i] ) );
+                next.m_keys[j] = m_keys[i];
+                next.m_values[j] = m_values[i];
+            }
+        }
+        swap( next );
+    }
+
+    std::vector<int8_t> m_ctrl;     // control byte per slot: empty, deleted, or 7 hash bits
+    std::vector<Key> m_keys;
+    std::vector<V> m_values;
+    size_type m_size;               // full slots
+    size_type m_used;               // full and deleted slots
+    Hash m_hash;
+    Equal m_equal;
+};
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_FLAT_MAP_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,194 @@
+/*
+ * whole_value_hash.h
+ * hashing of whole values and std::hash specializations.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * wv::hash<K> hashes the bit pattern of the underlying value of K and passes
+ * it through a 64-bit mixing function, so consecutive ids spread over all
+ * bits of the hash instead of clustering like the identity hash that many
+ * standard libraries use for integers. Floating point -0.0 hashes like 0.0.
+ *
+ * std::hash is specialized for whole_value, bits, arithmetic, quantity and
+ * safe_bool. A sub type created with WV_DEFINE_TYPE is a different class
+ * that a partial specialization cannot match; WV_DEFINE_HASH( Sub ) at
+ * global scope specializes std::hash and std::equal_to for it.
+ * As whole_value itself has no operator==, std::equal_to is specialized for
+ * it, so that it can be used as key of the unordered containers.
+ *
+ * Per-tag seeding is optional: specialize wv::hash_seed<Tag> to give the
+ * hashes of one tag their own seed.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_HASH_H_INCLUDED
+#define G_WV_WHOLE_VALUE_HASH_H_INCLUDED
+
+#include "whole_value.h"
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <stdint.h>
+#include <type_traits>
+
+/**
+ * specialize std::hash and std::equal_to for a sub type created with
+ * WV_DEFINE_TYPE; use at global scope, with the qualified type name.
+ */
+#define WV_DEFINE_HASH( type_name ) \
+    namespace std { \
+        template<> struct hash< type_name > : ::wv::hash< type_name > {}; \
+        template<> struct equal_to< type_name > : ::wv::equal_to< type_name > {}; \
+    }
+
+namespace wv {
+
+/**
+ * seed for the hashes of values with tag TG; specialize to change.
+ */
+template< typename TG >
+struct hash_seed
+{
+    static uint64_t value() { return 0; }
+};
+
+/**
+ * 64-bit mixing function with full avalanche.
+ */
+inline uint64_t mix64( uint64_t x )
+{
+    x ^= x >> 32;
+    x *= 0xd6e8feb86659fd93ULL;
+    x ^= x >> 32;
+    x *= 0xd6e8feb86659fd93ULL;
+    x ^= x >> 32;
+    return x;
+}
+
+namespace detail {
+
+    template< typename T, bool Integral = std::is_integral<T>::value || std::is_enum<T>::value >
+    struct hash_bits
+    {
+        static uint64_t apply( T const x ) { return static_cast<uint64_t>( x ); }
+    };
+
+    template< typename T >
+    struct hash_bits< T, false >
+    {
+        static uint64_t apply( T const & x ) { return std::hash<T>()( x ); }
+    };
+
+    template<>
+    struct hash_bits< double, false >
+    {
+        static uint64_t apply( double const x )
+        {
+            uint64_t u = 0;
+            double const y = x == 0 ? 0.0 : x;
+            std::memcpy( &u, &y, sizeof y );
+            return u;
+        }
+    };
+
+    template<>
+    struct hash_bits< float, false >
+    {
+        static uint64_t apply( float const x )
+        {
+            uint32_t u = 0;
+            float const y = x == 0 ? 0.0f : x;
+            std::memcpy( &u, &y, sizeof y );
+            return u;
+        }
+    };
+
+    /**
+     * tag of a whole value type, also of a sub type.
+     */
+    template< typename T, typename TG > TG tag_of( whole_value<T,TG> const * );
+    template< typename T, typename TG > TG tag_of( bits<T,TG> const * );
+    template< typename T, typename TG > TG tag_of( arithmetic<T,TG> const * );
+    template< typename T, typename TG > TG tag_of( quantity<T,TG> const * );
+    template< typename TG > TG tag_of( safe_bool<TG> const * );
+
+} // namespace detail
+
+/**
+ * tag type of whole value type K.
+ */
+template< typename K >
+struct tag_of
+{
+    typedef decltype( detail::tag_of( static_cast<K const *>( 0 ) ) ) type;
+};
+
+/**
+ * hash of a whole value.
+ */
+template< typename K >
+struct hash
+{
+    typedef K argument_type;
+    typedef std::size_t result_type;
+
+    std::size_t operator()( K const & x ) const
+    {
+        return static_cast<std::size_t>( mix64(
+            detail::hash_bits< typename K::value_type >::apply( x.value() ) ^ hash_seed< typename tag_of<K>::type >::value() ) );
+    }
+};
+
+/**
+ * equality of whole values by underlying value; whole_value has no operator==.
+ */
+template< typename K >
+struct equal_to
+{
+    typedef K first_argument_type;
+    typedef K second_argument_type;
+    typedef bool result_type;
+
+    bool operator()( K const & x, K const & y ) const
+    {
+        return x.value() == y.value();
+    }
+};
+
+} // namespace wv
+
+namespace std {
+
+template< typename T, typename TG >
+struct equal_to< wv::whole_value<T,TG> > : wv::equal_to< wv::whole_value<T,TG> > {};
+
+template< typename T, typename TG >
+struct hash< wv::whole_value<T,TG> > : wv::hash< wv::whole_value<T,TG> > {};
+
+template< typename T, typename TG >
+struct hash< wv::bits<T,TG> > : wv::hash< wv::bits<T,TG> > {};
+
+template< typename T, typename TG >
+struct hash< wv::arithmetic<T,TG> > : wv::hash< wv::arithmetic<T,TG> > {};
+
+template< typename T, typename TG >
+struct hash< wv::quantity<T,TG> > : wv::hash< wv::quantity<T,TG> > {};
+
+template< typename TG >
+struct hash< wv::safe_bool<TG> > : wv::hash< wv::safe_bool<TG> > {};
+
+} // namespace std
+
+#endif // G_WV_WHOLE_VALUE_HASH_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,312 @@
+/*
+ * whole_value_index_vector.h
+ * vector indexed by a whole value index type.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * index_vector<NodeIndex, T> only accepts a NodeIndex as subscript and
+ * reports its size as a NodeIndex, so indices of different containers cannot
+ * be mixed up and no access unwraps by hand. With a 32-bit index type, an
+ * index_vector<NodeIndex, NodeIndex> adjacency array takes half the memory
+ * of one holding std::size_t.
+ *
+ * The Check policy decides what operator[] does with an index out of range:
+ * - no_bounds_check: nothing.
+ * - assert_bounds_check: assert(), free when NDEBUG is defined (default).
+ * - throw_bounds_check: throw std::out_of_range.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_INDEX_VECTOR_H_INCLUDED
+#define G_WV_WHOLE_VALUE_INDEX_VECTOR_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace wv {
+
+/**
+ * bounds check policy: no check.
+ */
+struct no_bounds_check
+{
+    static void check( std::size_t, std::size_t ) {}
+};
+
+/**
+ * bounds check policy: assert(), disappears with NDEBUG.
+ */
+struct assert_bounds_check
+{
+    static void check( std::size_t const i, std::size_t const size )
+    {
+        assert( i < size && "index_vector: index out of range" ); (void) i; (void) size;
+    }
+};
+
+/**
+ * bounds check policy: throw std::out_of_range.
+ */
+struct throw_bounds_check
+{
+    static void check( std::size_t const i, std::size_t const size )
+    {
+        if ( i >= size )
+            throw std::out_of_range( "index_vector: index out of range" );
+    }
+};
+
+namespace detail {
+
+    template< typename Index >
+    inline std::size_t to_size( Index const & i )
+    {
+        return static_cast<std::size_t>( i.value() );
+    }
+
+    template< typename Index >
+    inline Index to_index( std::size_t const n )
+    {
+        return Index( static_cast<typename Index::value_type>( n ) );
+    }
+} // namespace detail
+
+/**
+ * iterator that yields consecutive typed indices.
+ */
+template< typename Index >
+class index_iterator
+{
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef Index value_type;
+    typedef Index reference;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+
+    index_iterator() : m_index( 0 ) {}
+
+    explicit index_iterator( std::size_t const i ) : m_index( i ) {}
+
+    Index operator*() const { return detail::to_index<Index>( m_index ); }
+    Index operator[]( difference_type const n ) const { return detail::to_index<Index>( m_index + n ); }
+
+    index_iterator & operator++() { ++m_index; return *this; }
+    index_iterator & operator--() { --m_index; return *this; }
+    index_iterator operator++( int ) { index_iterator tmp(*this); ++m_index; return tmp; }
+    index_iterator operator--( int ) { index_iterator tmp(*this); --m_index; return tmp; }
+
+    index_iterator & operator+=( difference_type const n ) { m_index += n; return *this; }
+    index_iterator & operator-=( difference_type const n ) { m_index -= n; return *this; }
+
+    friend index_iterator operator+( index_iterator x, difference_type const n ) { return x += n; }
+    friend index_iterator operator+( difference_type const n, index_iterator x ) { return x += n; }
+    friend index_iterator operator-( index_iterator x, difference_type const n ) { return x -= n; }
+
+    friend difference_type operator-( index_iterator const & x, index_iterator const & y )
+    {
+        return difference_type( x.m_index ) - difference_type( y.m_index );
+    }
+
+    friend bool operator==( index_iterator const & x, index_iterator const & y ) { return x.m_index == y.m_index; }
+    friend bool operator!=( index_iterator const & x, index_iterator const & y ) { return x.m_index != y.m_index; }
+    friend bool operator< ( index_iterator const & x, index_iterator const & y ) { return x.m_index <  y.m_index; }
+    friend bool operator> ( index_iterator const & x, index_iterator const & y ) { return x.m_index >  y.m_index; }
+    friend bool operator<=( index_iterator const & x, index_iterator const & y ) { return x.m_index <= y.m_index; }
+    friend bool operator>=( index_iterator const & x, index_iterator const & y ) { return x.m_index >= y.m_index; }
+
+private:
+    std::size_t m_index;
+};
+
+/**
+ * typed indices [first, last), for range-based for loops.
+ */
+template< typename Index >
+class index_interval
+{
+public:
+    typedef index_iterator<Index> iterator;
+
+    index_interval( std::size_t const first, std::size_t const last ) : m_first( first ), m_last( last ) {}
+
+    iterator begin() const { return iterator( m_first ); }
+    iterator end() const { return iterator( m_last ); }
+
+    Index size() const { return detail::to_index<Index>( m_last - m_first ); }
+    bool empty() const { return m_first == m_last; }
+
+private:
+    std::size_t m_first;
+    std::size_t m_last;
+};
+
+/**
+ * vector of T that is indexed by Index.
+ */
+template< typename Index, typename T, typename Check = assert_bounds_check, typename A = std::allocator<T> >
+class index_vector
+{
+public:
+    typedef Index index_type;
+    typedef T value_type;
+    typedef A allocator_type;
+    typedef std::vector<T,A> vector_type;
+    typedef typename vector_type::reference reference;
+    typedef typename vector_type::const_reference const_reference;
+    typedef typename vector_type::iterator iterator;
+    typedef typename vector_type::const_iterator const_iterator;
+
+    index_vector() {}
+
+    explicit index_vector( Index const n, T const & x = T() ) : m_v( detail::to_size( n ), x ) {}
+
+    explicit index_vector( vector_type v ) : m_v( std::move( v ) ) {}
+
+    /**
+     * number of elements, as index type.
+     */
+    Index size() const { return detail::to_index<Index>( m_v.size() ); }
+
+    bool empty() const { return m_v.empty(); }
+
+    Index capacity() const { return detail::to_index<Index>( m_v.capacity() ); }
+
+    /**
+     * largest size the index type can address.
+     */
+    static std::size_t max_size()
+    {
+        return static_cast<std::size_t>( ( std::numeric_limits<typename Index::value_type>::max )() );
+    }
+
+    void reserve( Index const n ) { m_v.reserve( detail::to_size( n ) ); }
+
+    void resize( Index const n ) { m_v.resize( detail::to_size( n ) ); }
+    void resize( Index const n, T const & x ) { m_v.resize( detail::to_size( n ), x ); }
+
+    void clear() { m_v.clear(); }
+
+    /**
+     * append x and return its index.
+     */
+    Index push_back( T const & x )
+    {
+        assert( m_v.size() < max_size() && "index_vector: index type overflow" );
+        m_v.push_back( x );
+        return detail::to_index<Index>( m_v.size() - 1 );
+    }
+
+    Index push_back( T && x )
+    {
+        assert( m_v.size() < max_size() && "index_vector: index type overflow" );
+        m_v.push_back( std::move( x ) );
+        return detail::to_index<Index>( m_v.size() - 1 );
+    }
+
+    template< typename... Args >
+    Index emplace_back( Args &&... args )
+    {
+        assert( m_v.size() < max_size() && "index_vector: index type overflow" );
+        m_v.emplace_back( std::forward<Args>( args )... );
+        return detail::to_index<Index>( m_v.size() - 1 );
+    }
+
+    void pop_back() { m_v.pop_back(); }
+
+    reference operator[]( Index const i )
+    {
+        Check::check( detail::to_size( i ), m_v.size() );
+        return m_v[ detail::to_size( i ) ];
+    }
+
+    const_reference operator[]( Index const i ) const
+    {
+        Check::check( detail::to_size( i ), m_v.size() );
+        return m_v[ detail::to_size( i ) ];
+    }
+
+    /**
+     * access with range check, whatever the policy.
+     */
+    reference at( Index const i )
+    {
+        throw_bounds_check::check( detail::to_size( i ), m_v.size() );
+        return m_v[ detail::to_size( i ) ];
+    }
+
+    const_reference at( Index const i ) const
+    {
+        throw_bounds_check::check( detail::to_size( i ), m_v.size() );
+        return m_v[ detail::to_size( i ) ];
+    }
+
+    reference front() { return m_v.front(); }
+    reference back() { return m_v.back(); }
+    const_reference front() const { return m_v.front(); }
+    const_reference back() const { return m_v.back(); }
+
+    T * data() { return m_v.data(); }
+    T const * data() const { return m_v.data(); }
+
+    iterator begin() { return m_v.begin(); }
+    iterator end() { return m_v.end(); }
+    const_iterator begin() const { return m_v.begin(); }
+    const_iterator end() const { return m_v.end(); }
+
+    /**
+     * all valid indices: for ( NodeIndex i : v.indices() ) ...
+     */
+    index_interval<Index> indices() const { return index_interval<Index>( 0, m_v.size() ); }
+
+    /**
+     * index of the element an iterator refers to.
+     */
+    Index index_of( const_iterator const it ) const
+    {
+        return detail::to_index<Index>( it - m_v.begin() );
+    }
+
+    /**
+     * the elements as span, for the bulk kernels.
+     */
+    span<T> as_span() { return make_span( m_v ); }
+    span<T const> as_span() const { return make_span( m_v ); }
+
+    vector_type const & vector() const { return m_v; }
+
+    friend void swap( index_vector & first, index_vector & second )
+    {
+        first.m_v.swap( second.m_v );
+    }
+
+    friend bool operator==( index_vector const & x, index_vector const & y ) { return x.m_v == y.m_v; }
+    friend bool operator!=( index_vector const & x, index_vector const & y ) { return x.m_v != y.m_v; }
+
+private:
+    vector_type m_v;
+};
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_INDEX_VECTOR_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,278 @@
+/*
+ * whole_value_modular.h
+ * modular arithmetic value type with Barrett reduction.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * modular<T, Modulus, TG> holds a residue in [0, Modulus) of unsigned T,
+ * uint32_t or uint64_t (the latter needs int128_t, see whole_value_fixed.h),
+ * and keeps it reduced through + - * and negation. With Modulus 0 the
+ * modulus is set at run time, once per tag, with set_modulus(); it is then
+ * stored aside, so a modular value always has the size of T.
+ *
+ * Addition and subtraction correct the result with a branchless
+ * conditional add or subtract of the modulus, so the modulus must not
+ * exceed 2^(bits - 1). Multiplication and construction reduce the double
+ * width product with Barrett's method: with mu = floor( 2^2n / m ), the
+ * quotient estimate is the high half of x * mu, which is at most one below
+ * the true quotient, so one conditional subtraction finishes it.
+ * For a compile-time modulus mu is a constant; for a run-time modulus it
+ * is computed by set_modulus(). Neither uses a division instruction.
+ *
+ * Use WV_DEFINE_MODULAR_TYPE() to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_MODULAR_H_INCLUDED
+#define G_WV_WHOLE_VALUE_MODULAR_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_fixed.h"
+
+#include <cassert>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+/**
+ * create modular value type; modulus 0 means set at run time.
+ */
+#define WV_DEFINE_MODULAR_TYPE( type_name, underlying_type, modulus ) \
+    struct type_name##_tag{}; \
+    typedef ::wv::modular<underlying_type, modulus, type_name##_tag> type_name;
+
+namespace wv {
+
+namespace detail {
+
+#ifdef G_WV_HAVE_INT128
+    /**
+     * high half of the double width product a * b.
+     */
+    inline uint128_t mulhi( uint128_t const a, uint128_t const b )
+    {
+        uint128_t const a0 = uint64_t( a ), a1 = a >> 64;
+        uint128_t const b0 = uint64_t( b ), b1 = b >> 64;
+        uint128_t const p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        uint128_t const middle = ( p00 >> 64 ) + uint64_t( p01 ) + uint64_t( p10 );
+        return p11 + ( p01 >> 64 ) + ( p10 >> 64 ) + ( middle >> 64 );
+    }
+#endif
+
+    /**
+     * double width type of T.
+     */
+    template< typename T >
+    struct modular_wide;
+
+    template<>
+    struct modular_wide< uint32_t >
+    {
+        typedef uint64_t type;
+    };
+
+#ifdef G_WV_HAVE_INT128
+    template<>
+    struct modular_wide< uint64_t >
+    {
+        typedef uint128_t type;
+    };
+#endif
+
+    /**
+     * floor( 2^2n / m ), or 2^2n - 1 for m = 1.
+     */
+    template< typename W, typename T >
+    W barrett_factor( T const m )
+    {
+        return W( W( ~W( 0 ) ) / m + W( m > 1 && ( m & ( m - 1 ) ) == 0 ) );
+    }
+
+    /**
+     * x mod m, for mu = barrett_factor( m ).
+     */
+    template< typename T, typename W >
+    T barrett_reduce( W const x, T const m, W const mu )
+    {
+        W const r = W( x - mulhi( x, mu ) * m );
+        return T( r - ( W( m ) & W( -W( r >= m ) ) ) );
+    }
+
+    /**
+     * compile-time modulus.
+     */
+    template< typename T, T Modulus, typename TG, bool Runtime = ( Modulus == 0 ) >
+    struct modulus
+    {
+        typedef typename modular_wide<T>::type W;
+
+        static T m() { return Modulus; }
+        static W mu() { return barrett_factor<W>( Modulus ); }
+    };
+
+    /**
+     * run-time modulus, per tag.
+     */
+    template< typename T, T Modulus, typename TG >
+    struct modulus< T, Modulus, TG, true >
+    {
+        typedef typename modular_wide<T>::type W;
+
+        static T m() { return s_m; }
+        static W mu() { return s_mu; }
+
+        static void set( T const m )
+        {
+            s_m = m;
+            s_mu = barrett_factor<W>( m );
+        }
+
+        static T s_m;
+        static W s_mu;
+    };
+
+    template< typename T, T Modulus, typename TG >
+    T modulus<T, Modulus, TG, true>::s_m = 1;
+
+    template< typename T, T Modulus, typename TG >
+    typename modulus<T, Modulus, TG, true>::W modulus<T, Modulus, TG, true>::s_mu = W( ~W( 0 ) );
+
+} // namespace detail
+
+/**
+ * residue modulo Modulus, or modulo the run-time modulus if Modulus is 0.
+ */
+template< typename T, T Modulus, typename TG >
+class modular
+{
+    typedef detail::modulus<T, Modulus, TG> M;
+    typedef typename detail::modular_wide<T>::type W;
+
+    static_assert( std::is_same<T, uint32_t>::value || std::is_same<T, uint64_t>::value, "modular needs uint32_t or uint64_t" );
+    static_assert( Modulus <= ( T( 1 ) << ( sizeof( T ) * 8 - 1 ) ), "modular: Modulus exceeds 2^(bits - 1)" );
+
+public:
+    typedef T value_type;
+
+    modular() : m_value( value_type() ) {}
+
+    /**
+     * value reduced modulo the modulus.
+     */
+    explicit modular( value_type const value ) : m_value( detail::barrett_reduce( W( value ), M::m(), M::mu() ) ) {}
+
+    /**
+     * the modulus.
+     */
+    static value_type modulus() { return M::m(); }
+
+    /**
+     * set the run-time modulus of this tag, 1 <= m <= 2^(bits - 1); set it
+     * before creating values, and not while other threads use them.
+     */
+    static void set_modulus( value_type const m )
+    {
+        static_assert( Modulus == 0, "set_modulus: modulus is fixed at compile time" );
+        assert( m >= 1 && m <= ( value_type( 1 ) << ( sizeof( T ) * 8 - 1 ) ) && "set_modulus: modulus out of range" );
+        M::set( m );
+    }
+
+    /**
+     * the residue, in [0, modulus).
+     */
+    value_type value() const { return m_value; }
+
+    friend void swap( modular & first, modular & second )
+    {
+        using std::swap;
+        swap( first.m_value, second.m_value );
+    }
+
+    friend bool operator==( modular const & x, modular const & y ) { return x.m_value == y.m_value; }
+    friend bool operator!=( modular const & x, modular const & y ) { return x.m_value != y.m_value; }
+
+    modular operator+() const { return *this; }
+    modular operator-() const { return from_residue( value_type( ( M::m() - m_value ) & value_type( -value_type( m_value != 0 ) ) ) ); }
+
+    modular & operator++() { return *this += from_residue( value_type( M::m() > 1 ) ); }
+    modular & operator--() { return *this -= from_residue( value_type( M::m() > 1 ) ); }
+
+    modular operator++( int ) { modular tmp( *this ); ++*this; return tmp; }
+    modular operator--( int ) { modular tmp( *this ); --*this; return tmp; }
+
+    modular & operator+=( modular const & other )
+    {
+        value_type const r = value_type( m_value + other.m_value );
+        m_value = value_type( r - ( M::m() & value_type( -value_type( r >= M::m() ) ) ) );
+        return *this;
+    }
+
+    modular & operator-=( modular const & other )
+    {
+        value_type const r = value_type( m_value - other.m_value );
+        m_value = value_type( r + ( M::m() & value_type( -value_type( m_value < other.m_value ) ) ) );
+        return *this;
+    }
+
+    modular & operator*=( modular const & other )
+    {
+        m_value = detail::barrett_reduce( W( W( m_value ) * other.m_value ), M::m(), M::mu() );
+        return *this;
+    }
+
+    friend modular operator+( modular x, modular const & y ) { return x += y; }
+    friend modular operator-( modular x, modular const & y ) { return x -= y; }
+    friend modular operator*( modular x, modular const & y ) { return x *= y; }
+
+    /**
+     * from a residue that is already reduced.
+     */
+    static modular from_residue( value_type const r )
+    {
+        assert( r < M::m() && "from_residue: value not reduced" );
+        modular x;
+        x.m_value = r;
+        return x;
+    }
+
+private:
+    value_type m_value;
+};
+
+/**
+ * x^e by square and multiply.
+ */
+template< typename T, T Modulus, typename TG >
+inline modular<T,Modulus,TG> pow( modular<T,Modulus,TG> x, uint64_t e )
+{
+    modular<T,Modulus,TG> result( 1 );
+    for ( ; e; e >>= 1 )
+    {
+        if ( e & 1 )
+            result *= x;
+        x *= x;
+    }
+    return result;
+}
+
+/**
+ * residue as underlying type, integer (long) and real (double).
+ */
+template< typename T, T Modulus, typename TG > inline T to_value( modular<T,Modulus,TG> const & x ) { return x.value(); }
+template< typename T, T Modulus, typename TG > inline long to_integer( modular<T,Modulus,TG> const & x ) { return long( x.value() ); }
+template< typename T, T Modulus, typename TG > inline double to_real( modular<T,Modulus,TG> const & x ) { return double( x.value() ); }
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_MODULAR_H_INCLUDED
+
+/*
+ * end of file
+ */
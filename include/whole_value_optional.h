@@ -0,0 +1,231 @@
+/*
+ * whole_value_optional.h
+ * optional whole values that mark the empty state with a sentinel value.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * optional<Q, Sentinel> holds a whole value Q or nothing, in the space of
+ * Q's underlying value: one value of the type is reserved as the sentinel
+ * for 'empty', so sizeof( optional<Q> ) == sizeof( Q ), where
+ * std::optional<double> takes 16 bytes for a flag and padding. The
+ * Sentinel policy says which value:
+ *
+ * - nan_sentinel:      NaN, for floating point (any NaN reads as empty),
+ * - lowest_sentinel:   the lowest value, INT_MIN for int,
+ * - all_ones_sentinel: all bits set, the maximum of an unsigned type,
+ * - value_sentinel<V>: the integral value V.
+ *
+ * The default is NaN for floating point, the lowest value for signed and all
+ * ones for unsigned types. Storing the sentinel as a value is an error
+ * (asserted). nan_sentinel relies on NaN != NaN, which -ffast-math breaks.
+ *
+ * As a span of optionals is a span of plain values, the bulk functions test
+ * for the sentinel with a comparison per element in loops that the compiler
+ * vectorizes (GCC and Clang at -O3): count_values() counts the values,
+ * select_values() gives a mask<Tag> of whole_value_filter.h, and value_or()
+ * replaces the empty elements.
+ *
+ * Use WV_DEFINE_OPTIONAL_TYPE() to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_OPTIONAL_H_INCLUDED
+#define G_WV_WHOLE_VALUE_OPTIONAL_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_filter.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+/**
+ * create optional type of whole value type with sentinel policy sentinel.
+ */
+#define WV_DEFINE_OPTIONAL_TYPE( type_name, whole_value_type, sentinel ) \
+    typedef ::wv::optional<whole_value_type, sentinel> type_name;
+
+namespace wv {
+
+/**
+ * sentinel policies: the value that marks empty, and the test for it.
+ */
+struct nan_sentinel
+{
+    template< typename T >
+    static constexpr T empty() { return std::numeric_limits<T>::quiet_NaN(); }
+
+    template< typename T >
+    static constexpr bool is_empty( T const x ) { return x != x; }
+};
+
+struct lowest_sentinel
+{
+    template< typename T >
+    static constexpr T empty() { return std::numeric_limits<T>::lowest(); }
+
+    template< typename T >
+    static constexpr bool is_empty( T const x ) { return x == std::numeric_limits<T>::lowest(); }
+};
+
+struct all_ones_sentinel
+{
+    template< typename T >
+    static constexpr T empty() { return T( ~T( 0 ) ); }
+
+    template< typename T >
+    static constexpr bool is_empty( T const x ) { return x == T( ~T( 0 ) ); }
+};
+
+template< intmax_t V >
+struct value_sentinel
+{
+    template< typename T >
+    static constexpr T empty() { return T( V ); }
+
+    template< typename T >
+    static constexpr bool is_empty( T const x ) { return x == T( V ); }
+};
+
+/**
+ * sentinel policy for underlying type T.
+ */
+template< typename T >
+struct default_sentinel
+{
+    typedef typename std::conditional< std::is_floating_point<T>::value, nan_sentinel,
+        typename std::conditional< std::is_signed<T>::value, lowest_sentinel, all_ones_sentinel >::type >::type type;
+};
+
+/**
+ * whole value Q or nothing, nothing being the sentinel value.
+ */
+template< typename Q, typename Sentinel = typename default_sentinel< typename Q::value_type >::type >
+class optional
+{
+public:
+    typedef typename Q::value_type value_type;
+    typedef Q whole_value_type;
+    typedef Sentinel sentinel_type;
+
+    /**
+     * empty.
+     */
+    constexpr optional() : m_value( Sentinel::template empty<value_type>() ) {}
+
+    optional( Q const & x ) : m_value( x.value() )
+    {
+        assert( !Sentinel::is_empty( m_value ) && "optional: value is the sentinel" );
+    }
+
+    bool has_value() const { return !Sentinel::is_empty( m_value ); }
+
+    explicit operator bool() const { return has_value(); }
+
+    Q value() const
+    {
+        assert( has_value() && "optional: empty" );
+        return Q( m_value );
+    }
+
+    Q value_or( Q const & other ) const { return has_value() ? Q( m_value ) : other; }
+
+    void reset() { m_value = Sentinel::template empty<value_type>(); }
+
+    friend void swap( optional & first, optional & second )
+    {
+        using std::swap;
+        swap( first.m_value, second.m_value );
+    }
+
+    /**
+     * equal when both are empty or both hold the same value.
+     */
+    friend bool operator==( optional const & x, optional const & y )
+    {
+        return x.has_value() == y.has_value() && ( !x.has_value() || x.m_value == y.m_value );
+    }
+
+    friend bool operator!=( optional const & x, optional const & y ) { return !( x == y ); }
+
+private:
+    value_type m_value;
+};
+
+namespace detail {
+
+    template< typename Sentinel >
+    struct has_value_of
+    {
+        template< typename T >
+        bool operator()( T const x ) const { return !Sentinel::is_empty( x ); }
+    };
+
+} // namespace detail
+
+/**
+ * number of optionals that hold a value.
+ */
+template< typename O >
+std::size_t count_values( span<O> const a )
+{
+    typedef typename std::remove_const<O>::type V;
+    typedef typename V::value_type T;
+    typedef typename V::sentinel_type S;
+
+    T const * const p = values( span<V const>( a ) ).data();
+
+    std::size_t n = 0;
+    for ( std::size_t i = 0; i < a.size(); ++i )
+        n += !S::is_empty( p[i] );
+    return n;
+}
+
+/**
+ * mask of the rows that hold a value.
+ */
+template< typename Tag, typename O >
+mask<Tag> select_values( span<O> const a )
+{
+    return select_if<Tag>( a, detail::has_value_of< typename std::remove_const<O>::type::sentinel_type >() );
+}
+
+/**
+ * out[i] = a[i].value_or( other ).
+ */
+template< typename O, typename Q >
+void value_or( span<O> const a, Q const & other, span<Q> const out )
+{
+    typedef typename std::remove_const<O>::type V;
+    typedef typename V::value_type T;
+    typedef typename V::sentinel_type S;
+
+    static_assert( std::is_same< typename V::whole_value_type, Q >::value, "value_or: different whole value types" );
+    assert( a.size() == out.size() && "value_or: different sizes" );
+
+    T const * const p = values( span<V const>( a ) ).data();
+    T * const r = values( out ).data();
+    T const x = other.value();
+
+    for ( std::size_t i = 0; i < a.size(); ++i )
+        r[i] = S::is_empty( p[i] ) ? x : p[i];
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_OPTIONAL_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,484 @@
+/*
+ * whole_value_packed.h
+ * arrays of narrow whole values packed at a fixed bit width.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * packed_array<Q, Bits> stores whole values Q of unsigned integral underlying
+ * type in Bits bits each, 1 <= Bits <= 32: a column of 12-bit values takes
+ * 1.5 bytes per row instead of 4. Values must be below 2^Bits (asserted).
+ *
+ * The layout is vertical, as in SIMD bit packing (Lemire and Boytsov): rows
+ * come in blocks of 128, and row 4 j + k of a block is value j of lane k,
+ * each lane a stream of 32 values in Bits 32-bit words, the words of the
+ * four lanes interleaved. Every 128-bit group of words then holds the same
+ * bit positions of four consecutive rows, so four rows unpack together with
+ * one shift and mask for all lanes. With SSE2 the 32 steps of a block are
+ * unrolled at compile time, with constant shifts; otherwise a portable loop
+ * does the same. A block is Bits 128-bit groups.
+ *
+ * get() and set() access a single row: a 64-bit window over two words of
+ * its lane, a shift and a mask, without branches. unpack() and pack()
+ * convert between the packed array and a span of Q, a block at a time.
+ * sum() and the select functions scan the packed form: for_each_block()
+ * unpacks each block to 128 values in a buffer that stays in the L1 cache,
+ * where they are summed or compared. Like the functions of the same name
+ * for spans, sum() adds in the accumulator type of whole_value_accumulate.h
+ * and select_less() and friends give a mask<Tag> of whole_value_filter.h.
+ * for_each_block() serves other scans likewise.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_PACKED_H_INCLUDED
+#define G_WV_WHOLE_VALUE_PACKED_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_accumulate.h"
+#include "whole_value_filter.h"
+#include "whole_value_span.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+# include <emmintrin.h>
+# define G_WV_HAVE_SSE2
+#endif
+
+namespace wv {
+
+namespace detail {
+
+#ifdef G_WV_HAVE_SSE2
+    /**
+     * value J of the four lanes of a block, and the following ones: unrolled
+     * at compile time, so that the shifts are constants.
+     */
+    template< unsigned Bits, unsigned J = 0 >
+    struct packed_lanes
+    {
+        static const unsigned w = J * Bits / 32;
+        static const unsigned s = J * Bits % 32;
+
+        static void unpack( __m128i const * const q, __m128i const m, uint32_t * const out )
+        {
+            __m128i v = _mm_srli_epi32( _mm_loadu_si128( q + w ), s );
+            if ( s + Bits > 32 )
+                v = _mm_or_si128( v, _mm_slli_epi32( _mm_loadu_si128( q + w + 1 ), 32 - s ) );
+            _mm_storeu_si128( reinterpret_cast<__m128i *>( out + 4 * J ), _mm_and_si128( v, m ) );
+
+            packed_lanes<Bits, J + 1>::unpack( q, m, out );
+        }
+
+        static void pack( uint32_t const * const in, __m128i * const q, __m128i word )
+        {
+            __m128i const v = _mm_loadu_si128( reinterpret_cast<__m128i const *>( in + 4 * J ) );
+            word = _mm_or_si128( word, _mm_slli_epi32( v, s ) );
+            if ( s + Bits >= 32 )
+            {
+                _mm_storeu_si128( q + w, word );
+                word = _mm_srli_epi32( v, 32 - s );
+            }
+
+            packed_lanes<Bits, J + 1>::pack( in, q, word );
+        }
+    };
+
+    template< unsigned Bits >
+    struct packed_lanes< Bits, 32 >
+    {
+        static void unpack( __m128i const *, __m128i, uint32_t * ) {}
+        static void pack( uint32_t const *, __m128i *, __m128i ) {}
+    };
+#endif
+
+    /**
+     * unpack the block at p, Bits 128-bit groups, to 128 values in row order.
+     */
+    template< unsigned Bits >
+    void packed_unpack_block( uint32_t const * const p, uint32_t * const out )
+    {
+        uint32_t const mask = uint32_t( ( uint64_t( 1 ) << Bits ) - 1 );
+#ifdef G_WV_HAVE_SSE2
+        packed_lanes<Bits>::unpack( reinterpret_cast<__m128i const *>( p ), _mm_set1_epi32( int( mask ) ), out );
+#else
+        for ( unsigned j = 0; j < 32; ++j )
+        {
+            unsigned const w = j * Bits / 32, s = j * Bits % 32;
+            for ( unsigned k = 0; k < 4; ++k )
+            {
+                uint64_t const window = ( uint64_t( p[ 4 * w + 4 + k ] ) << 32 ) | p[ 4 * w + k ];
+                out[ 4 * j + k ] = uint32_t( window >> s ) & mask;
+            }
+        }
+#endif
+    }
+
+    /**
+     * pack 128 values in row order, each below 2^Bits, to the block at p.
+     */
+    template< unsigned Bits >
+    void packed_pack_block( uint32_t const * const in, uint32_t * const p )
+    {
+#ifdef G_WV_HAVE_SSE2
+        packed_lanes<Bits>::pack( in, reinterpret_cast<__m128i *>( p ), _mm_setzero_si128() );
+#else
+        for ( unsigned i = 0; i < 4 * Bits; ++i )
+            p[i] = 0;
+
+        for ( unsigned j = 0; j < 32; ++j )
+        {
+            unsigned const w = j * Bits / 32, s = j * Bits % 32;
+            for ( unsigned k = 0; k < 4; ++k )
+            {
+                uint64_t const v = uint64_t( in[ 4 * j + k ] ) << s;
+                p[ 4 * w + k ] |= uint32_t( v );
+                if ( s + Bits > 32 )
+                    p[ 4 * w + 4 + k ] |= uint32_t( v >> 32 );
+            }
+        }
+#endif
+    }
+
+} // namespace detail
+
+/**
+ * array of whole values Q stored in Bits bits each.
+ */
+template< typename Q, unsigned Bits >
+class packed_array
+{
+public:
+    typedef Q value_type;
+    typedef typename Q::value_type underlying_type;
+    typedef std::size_t size_type;
+
+    static_assert( std::is_integral<underlying_type>::value && std::is_unsigned<underlying_type>::value, "packed_array needs an unsigned integral underlying type" );
+    static_assert( Bits >= 1 && Bits <= 32 && Bits <= unsigned( std::numeric_limits<underlying_type>::digits ), "packed_array: Bits must be in [1, 32] and fit the underlying type" );
+
+    static const unsigned bits = Bits;
+    static const size_type block_size = 128;
+    static const size_type block_words = 4 * Bits;
+
+    /**
+     * largest value that fits.
+     */
+    static const uint32_t max_value = uint32_t( ( uint64_t( 1 ) << Bits ) - 1 );
+
+    packed_array() : m_words( 4 ), m_size( 0 ) {}
+
+    /**
+     * n rows of value 0.
+     */
+    explicit packed_array( size_type const n ) : m_words( words_for( n ), 0 ), m_size( n ) {}
+
+    /**
+     * the values of a.
+     */
+    template< typename V >
+    explicit packed_array( span<V> const a ) : m_size( 0 )
+    {
+        pack( a, *this );
+    }
+
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * resize to n rows, new rows are 0.
+     */
+    void resize( size_type const n )
+    {
+        for ( size_type i = n; i < m_size && i % block_size; ++i )
+            set( i, Q( 0 ) );
+        m_words.resize( words_for( n ), 0 );
+        std::fill( m_words.end() - 4, m_words.end(), 0 );
+        m_size = n;
+    }
+
+    void push_back( Q const & x )
+    {
+        resize( m_size + 1 );
+        set( m_size - 1, x );
+    }
+
+    /**
+     * x fits in Bits bits.
+     */
+    static bool fits( Q const & x ) { return x.value() <= max_value; }
+
+    Q get( size_type const i ) const
+    {
+        assert( i < m_size );
+        uint32_t const * const p = word_of( i );
+        uint64_t const window = ( uint64_t( p[4] ) << 32 ) | p[0];
+        return Q( underlying_type( uint32_t( window >> shift_of( i ) ) & max_value ) );
+    }
+
+    Q operator[]( size_type const i ) const { return get( i ); }
+
+    void set( size_type const i, Q const & x )
+    {
+        assert( i < m_size );
+        assert( fits( x ) && "packed_array: value wider than Bits" );
+        uint32_t * const p = word_of( i );
+        unsigned const s = shift_of( i );
+        uint64_t window = ( uint64_t( p[4] ) << 32 ) | p[0];
+        window = ( window & ~( uint64_t( max_value ) << s ) ) | ( uint64_t( x.value() ) << s );
+        p[0] = uint32_t( window );
+        p[4] = uint32_t( window >> 32 );
+    }
+
+    /**
+     * the packed words, block after block, and their size in bytes.
+     */
+    span<uint32_t const> words() const { return make_span( m_words ); }
+
+    size_type bytes() const { return m_words.size() * sizeof( uint32_t ); }
+
+    friend void swap( packed_array & first, packed_array & second )
+    {
+        first.m_words.swap( second.m_words );
+        std::swap( first.m_size, second.m_size );
+    }
+
+    friend bool operator==( packed_array const & x, packed_array const & y ) { return x.m_size == y.m_size && x.m_words == y.m_words; }
+    friend bool operator!=( packed_array const & x, packed_array const & y ) { return !( x == y ); }
+
+private:
+    template< typename V, typename Q2, unsigned B2 >
+    friend void pack( span<V> const a, packed_array<Q2, B2> & out );
+
+    /**
+     * whole blocks for n rows, and a group of words past the end that the
+     * 64-bit window of the last row may read.
+     */
+    static size_type words_for( size_type const n ) { return ( n + block_size - 1 ) / block_size * block_words + 4; }
+
+    uint32_t const * word_of( size_type const i ) const
+    {
+        size_type const r = i % block_size;
+        return m_words.data() + i / block_size * block_words + r / 4 * Bits / 32 * 4 + r % 4;
+    }
+
+    uint32_t * word_of( size_type const i )
+    {
+        return const_cast<uint32_t *>( static_cast<packed_array const *>( this )->word_of( i ) );
+    }
+
+    static unsigned shift_of( size_type const i ) { return unsigned( i % block_size / 4 * Bits % 32 ); }
+
+    std::vector<uint32_t> m_words;
+    size_type m_size;
+};
+
+template< typename Q, unsigned Bits > const unsigned packed_array<Q, Bits>::bits;
+template< typename Q, unsigned Bits > const typename packed_array<Q, Bits>::size_type packed_array<Q, Bits>::block_size;
+template< typename Q, unsigned Bits > const typename packed_array<Q, Bits>::size_type packed_array<Q, Bits>::block_words;
+template< typename Q, unsigned Bits > const uint32_t packed_array<Q, Bits>::max_value;
+
+/**
+ * call f( values, count ) for each block of a, with values its 128 unpacked
+ * rows of which the first count are in a; the others are 0.
+ */
+template< typename Q, unsigned Bits, typename F >
+void for_each_block( packed_array<Q, Bits> const & a, F f )
+{
+    uint32_t buffer[128];
+    uint32_t const * const p = a.words().data();
+    std::size_t const n = a.size();
+
+    for ( std::size_t i = 0; i < n; i += 128 )
+    {
+        detail::packed_unpack_block<Bits>( p + i / 128 * 4 * Bits, buffer );
+        f( static_cast<uint32_t const *>( buffer ), n - i < 128 ? n - i : std::size_t( 128 ) );
+    }
+}
+
+/**
+ * out[i] = a[i].
+ */
+template< typename Q, unsigned Bits >
+void unpack( packed_array<Q, Bits> const & a, span<Q> const out )
+{
+    typedef typename Q::value_type T;
+
+    assert( a.size() == out.size() && "unpack: different sizes" );
+
+    T * const r = values( out ).data();
+    uint32_t const * const p = a.words().data();
+    std::size_t const n = a.size();
+    std::size_t const full = n / 128;
+
+    for ( std::size_t b = 0; b < full; ++b )
+    {
+        if ( sizeof( T ) == sizeof( uint32_t ) )
+        {
+            detail::packed_unpack_block<Bits>( p + b * 4 * Bits, reinterpret_cast<uint32_t *>( r + 128 * b ) );
+        }
+        else
+        {
+            uint32_t buffer[128];
+            detail::packed_unpack_block<Bits>( p + b * 4 * Bits, buffer );
+            for ( unsigned i = 0; i < 128; ++i )
+                r[ 128 * b + i ] = T( buffer[i] );
+        }
+    }
+
+    if ( n % 128 )
+    {
+        uint32_t buffer[128];
+        detail::packed_unpack_block<Bits>( p + full * 4 * Bits, buffer );
+        for ( std::size_t i = 0; i < n % 128; ++i )
+            r[ 128 * full + i ] = T( buffer[i] );
+    }
+}
+
+/**
+ * out = the values of a, each below 2^Bits.
+ */
+template< typename V, typename Q, unsigned Bits >
+void pack( span<V> const a, packed_array<Q, Bits> & out )
+{
+    typedef typename Q::value_type T;
+
+    static_assert( std::is_same< typename std::remove_const<V>::type, Q >::value, "pack: different whole value types" );
+
+    // every block is written, only the words past the end are cleared:
+    out.m_words.resize( packed_array<Q, Bits>::words_for( a.size() ) );
+    std::fill( out.m_words.end() - 4, out.m_words.end(), 0 );
+    out.m_size = a.size();
+
+    T const * const x = values( span<Q const>( a ) ).data();
+    uint32_t * const p = out.m_words.data();
+    std::size_t const n = a.size();
+
+#ifndef NDEBUG
+    uint32_t const max_value = packed_array<Q, Bits>::max_value;
+    for ( std::size_t i = 0; i < n; ++i )
+        assert( x[i] <= max_value && "pack: value wider than Bits" );
+#endif
+
+    for ( std::size_t b = 0; b * 128 < n; ++b )
+    {
+        std::size_t const count = n - 128 * b < 128 ? n - 128 * b : 128;
+
+        if ( sizeof( T ) == sizeof( uint32_t ) && count == 128 )
+        {
+            detail::packed_pack_block<Bits>( reinterpret_cast<uint32_t const *>( x + 128 * b ), p + b * 4 * Bits );
+        }
+        else
+        {
+            uint32_t buffer[128] = {};
+            for ( std::size_t i = 0; i < count; ++i )
+                buffer[i] = uint32_t( x[ 128 * b + i ] );
+            detail::packed_pack_block<Bits>( buffer, p + b * 4 * Bits );
+        }
+    }
+}
+
+/**
+ * sum of the values in the accumulator type of whole_value_accumulate.h.
+ */
+template< typename Q, unsigned Bits >
+typename accumulator<Q>::type sum( packed_array<Q, Bits> const & a )
+{
+    typedef typename accumulator<Q>::type R;
+
+    // a block of values below 2^25 adds up in 32 bits:
+    typedef typename std::conditional< ( Bits <= 25 ), uint32_t, uint64_t >::type S;
+
+    uint64_t total = 0;
+    // rows past the end are 0:
+    for_each_block( a, [&total]( uint32_t const * const v, std::size_t )
+    {
+        S s = 0;
+        for ( unsigned i = 0; i < 128; ++i )
+            s += v[i];
+        total += s;
+    } );
+    return R( typename R::value_type( total ) );
+}
+
+namespace detail {
+
+    /**
+     * mask of the lowest count bits of a word.
+     */
+    inline uint64_t packed_tail( std::size_t const count )
+    {
+        return count < 64 ? ( uint64_t( 1 ) << count ) - 1 : ~uint64_t( 0 );
+    }
+
+    template< typename Tag, typename Cmp, typename Q, unsigned Bits >
+    mask<Tag> packed_select( packed_array<Q, Bits> const & a, Q const & limit )
+    {
+        typedef typename Q::value_type T;
+
+        mask<Tag> m( a.size() );
+        uint64_t * w = m.words().data();
+        T const k = limit.value();
+
+        for_each_block( a, [&]( uint32_t const * const v, std::size_t const count )
+        {
+            uint8_t b[128];
+            for ( unsigned i = 0; i < 128; ++i )
+                b[i] = Cmp()( T( v[i] ), k );
+
+            if ( count > 64 )
+            {
+                w[0] = pack_bytes( b );
+                w[1] = pack_bytes( b + 64 ) & packed_tail( count - 64 );
+            }
+            else
+            {
+                w[0] = pack_bytes( b ) & packed_tail( count );
+            }
+            w += 2;
+        } );
+        return m;
+    }
+
+} // namespace detail
+
+/**
+ * mask of the rows with value less than, less than or equal to, greater than,
+ * greater than or equal to, equal to, or unequal to limit.
+ */
+template< typename Tag, typename Q, unsigned Bits >
+mask<Tag> select_less( packed_array<Q, Bits> const & a, Q const & limit ) { return detail::packed_select<Tag, detail::less>( a, limit ); }
+
+template< typename Tag, typename Q, unsigned Bits >
+mask<Tag> select_less_equal( packed_array<Q, Bits> const & a, Q const & limit ) { return detail::packed_select<Tag, detail::less_equal>( a, limit ); }
+
+template< typename Tag, typename Q, unsigned Bits >
+mask<Tag> select_greater( packed_array<Q, Bits> const & a, Q const & limit ) { return detail::packed_select<Tag, detail::greater>( a, limit ); }
+
+template< typename Tag, typename Q, unsigned Bits >
+mask<Tag> select_greater_equal( packed_array<Q, Bits> const & a, Q const & limit ) { return detail::packed_select<Tag, detail::greater_equal>( a, limit ); }
+
+template< typename Tag, typename Q, unsigned Bits >
+mask<Tag> select_equal( packed_array<Q, Bits> const & a, Q const & limit ) { return detail::packed_select<Tag, detail::equal>( a, limit ); }
+
+template< typename Tag, typename Q, unsigned Bits >
+mask<Tag> select_not_equal( packed_array<Q, Bits> const & a, Q const & limit ) { return detail::packed_select<Tag, detail::not_equal>( a, limit ); }
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_PACKED_H_INCLUDED
+
+/*
+ * end of file
+ */
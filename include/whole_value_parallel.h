@@ -0,0 +1,162 @@
+/*
+ * whole_value_parallel.h
+ * static work partitioning over worker threads for bulk operations.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11 (std::thread).
+ *
+ * parallel_for() splits [first, last) into one contiguous chunk per thread.
+ * The split depends only on the range, the thread count and the grain, so two
+ * calls with the same arguments hand every thread the same elements. This is
+ * what makes first-touch page placement (see whole_value_column.h) pay off:
+ * the thread that initialized a chunk is the thread that later scans it.
+ *
+ * parallel_for() joins its threads before it returns, also when f throws or a
+ * thread cannot be started; an exception thrown by f on a worker thread is
+ * passed on to the caller after the join.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_PARALLEL_H_INCLUDED
+#define G_WV_WHOLE_VALUE_PARALLEL_H_INCLUDED
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace wv {
+
+/**
+ * number of hardware threads, at least 1.
+ */
+inline unsigned hardware_threads()
+{
+    unsigned const n = std::thread::hardware_concurrency();
+    return n ? n : 1;
+}
+
+/**
+ * half-open index range [first, last).
+ */
+struct index_range
+{
+    std::size_t first;
+    std::size_t last;
+
+    std::size_t size() const { return last - first; }
+};
+
+/**
+ * chunk of [first, last) for thread 'index' of 'threads';
+ * chunk boundaries are multiples of 'grain' (relative to first).
+ */
+inline index_range partition( std::size_t const first, std::size_t const last,
+                              unsigned const index, unsigned const threads,
+                              std::size_t const grain = 1 )
+{
+    std::size_t const grains = ( last - first + grain - 1 ) / grain;
+    std::size_t const lo = first + grains *   index       / threads * grain;
+    std::size_t const hi = first + grains * ( index + 1 ) / threads * grain;
+
+    index_range const r = { lo < last ? lo : last, hi < last ? hi : last };
+    return r;
+}
+
+namespace detail {
+
+    // elements per thread below which a thread does not pay off:
+    static const std::size_t parallel_grain = 16384;
+
+    /**
+     * threads to use for n elements: 'threads', or all hardware threads if 0,
+     * but no more than one per parallel_grain elements and at least 1.
+     */
+    inline unsigned parallel_threads( unsigned const threads, std::size_t const n )
+    {
+        unsigned const t = threads ? threads : hardware_threads();
+        std::size_t const most = ( n + parallel_grain - 1 ) / parallel_grain;
+        return most < t ? unsigned( most ? most : 1 ) : t;
+    }
+
+    /**
+     * threads that are joined when the group goes out of scope.
+     */
+    struct joining_threads
+    {
+        std::vector<std::thread> threads;
+
+        ~joining_threads()
+        {
+            for ( std::size_t i = 0; i < threads.size(); ++i )
+                if ( threads[i].joinable() )
+                    threads[i].join();
+        }
+    };
+
+} // namespace detail
+
+/**
+ * call f( first_i, last_i, i ) for every chunk i of [first, last) on its own
+ * thread; chunk 0 runs on the calling thread. The first exception, of the
+ * calling thread or else of the lowest worker, is rethrown after all threads
+ * finished.
+ */
+template< typename F >
+void parallel_for( std::size_t const first, std::size_t const last,
+                   unsigned threads, F f, std::size_t const grain = 1 )
+{
+    if ( threads == 0 )
+        threads = hardware_threads();
+
+    if ( threads == 1 || last - first <= grain )
+    {
+        f( first, last, 0u );
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors( threads );
+    {
+        detail::joining_threads workers;
+        workers.threads.reserve( threads - 1 );
+
+        for ( unsigned i = 1; i < threads; ++i )
+        {
+            index_range const r = partition( first, last, i, threads, grain );
+            std::exception_ptr * const error = &errors[i];
+
+            workers.threads.push_back( std::thread( [f, r, i, error]() mutable
+            {
+                try
+                {
+                    f( r.first, r.last, i );
+                }
+                catch ( ... )
+                {
+                    *error = std::current_exception();
+                }
+            } ) );
+        }
+
+        index_range const r = partition( first, last, 0, threads, grain );
+        f( r.first, r.last, 0u );
+    }
+
+    for ( std::size_t i = 0; i < errors.size(); ++i )
+        if ( errors[i] )
+            std::rethrow_exception( errors[i] );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_PARALLEL_H_INCLUDED
+
+/*
+ * end of file
+ */
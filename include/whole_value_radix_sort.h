@@ -0,0 +1,352 @@
+/*
+ * whole_value_radix_sort.h
+ * LSD radix sort on the bit pattern of arithmetic and quantity values.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * radix_sort() sorts whole values with an integral or IEEE-754 underlying
+ * type by the bits of that value, without calling the comparison, swap or
+ * assignment operators of the whole value type. Each value is mapped to an
+ * unsigned key that orders like the value:
+ * - unsigned: the value itself,
+ * - signed: the sign bit flipped,
+ * - floating point: all bits flipped for negative values, the sign bit
+ *   flipped for positive values.
+ * Keys are sorted 8 bits per pass, least significant first; a pass in which
+ * all keys have the same digit is skipped. The sort is stable. -0.0 sorts
+ * before 0.0, and NaNs sort before all other values (negative NaN) or after
+ * them (positive NaN).
+ *
+ * With threads > 1 each pass is split over the threads: every thread counts
+ * the digits of its chunk, and scatters its chunk to offsets derived from
+ * all counts, which keeps the result identical to the sequential sort.
+ *
+ * radix_sort_by_key() sorts keys and applies the same permutation to a span
+ * of values; it handles up to 2^32 - 1 elements.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_RADIX_SORT_H_INCLUDED
+#define G_WV_WHOLE_VALUE_RADIX_SORT_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_parallel.h"
+#include "whole_value_span.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace wv {
+
+namespace detail {
+
+    template< std::size_t N > struct unsigned_of_size;
+    template<> struct unsigned_of_size<1> { typedef uint8_t  type; };
+    template<> struct unsigned_of_size<2> { typedef uint16_t type; };
+    template<> struct unsigned_of_size<4> { typedef uint32_t type; };
+    template<> struct unsigned_of_size<8> { typedef uint64_t type; };
+
+} // namespace detail
+
+/**
+ * order-preserving map between T and an unsigned key of the same size.
+ */
+template< typename T, typename Enable = void >
+struct radix_key;
+
+template< typename T >
+struct radix_key< T, typename std::enable_if< std::is_integral<T>::value >::type >
+{
+    typedef typename detail::unsigned_of_size< sizeof( T ) >::type type;
+
+    static const type flip = std::is_signed<T>::value ? type( type( 1 ) << ( 8 * sizeof( T ) - 1 ) ) : type( 0 );
+
+    static type to_key( T const x ) { return type( static_cast<type>( x ) ^ flip ); }
+    static T from_key( type const k ) { return static_cast<T>( type( k ^ flip ) ); }
+};
+
+template< typename T >
+struct radix_key< T, typename std::enable_if< std::is_floating_point<T>::value >::type >
+{
+    typedef typename detail::unsigned_of_size< sizeof( T ) >::type type;
+
+    static const type sign = type( type( 1 ) << ( 8 * sizeof( T ) - 1 ) );
+
+    static type to_key( T const x )
+    {
+        type u;
+        std::memcpy( &u, &x, sizeof x );
+        return u & sign ? type( ~u ) : type( u | sign );
+    }
+
+    static T from_key( type const k )
+    {
+        type const u = k & sign ? type( k & ~sign ) : type( ~k );
+        T x;
+        std::memcpy( &x, &u, sizeof x );
+        return x;
+    }
+};
+
+namespace detail {
+
+    /**
+     * scatter keys [first, last) of src to dst at offset[digit]++, carrying
+     * the index permutation along when Perm.
+     */
+    template< bool Perm, typename K >
+    void radix_scatter( K const * const src, K * const dst,
+                        uint32_t const * const perm_src, uint32_t * const perm_dst,
+                        std::size_t const first, std::size_t const last,
+                        unsigned const shift, std::size_t * const offset )
+    {
+        for ( std::size_t i = first; i < last; ++i )
+        {
+            std::size_t const j = offset[ ( src[i] >> shift ) & 0xff ]++;
+            dst[j] = src[i];
+            if ( Perm )
+                perm_dst[j] = perm_src[i];
+        }
+    }
+
+    /**
+     * sort n keys, sequentially; the counts of all digits are gathered in
+     * a single pass over the keys.
+     */
+    template< bool Perm, typename K >
+    void radix_sort_sequential( K * & keys, K * & tmp, uint32_t * & perm, uint32_t * & perm_tmp, std::size_t const n )
+    {
+        std::vector<std::size_t> counts( 256 * sizeof( K ), 0 );
+
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            K const k = keys[i];
+            for ( unsigned d = 0; d < sizeof( K ); ++d )
+                ++counts[ 256 * d + ( ( k >> ( 8 * d ) ) & 0xff ) ];
+        }
+
+        for ( unsigned d = 0; d < sizeof( K ); ++d )
+        {
+            std::size_t * const offset = &counts[ 256 * d ];
+            unsigned const shift = 8 * d;
+
+            // all keys have the same digit: no pass needed.
+            if ( offset[ ( keys[0] >> shift ) & 0xff ] == n )
+                continue;
+
+            std::size_t sum = 0;
+            for ( unsigned b = 0; b < 256; ++b )
+            {
+                std::size_t const c = offset[b];
+                offset[b] = sum;
+                sum += c;
+            }
+
+            radix_scatter<Perm>( keys, tmp, perm, perm_tmp, 0, n, shift, offset );
+            std::swap( keys, tmp );
+            std::swap( perm, perm_tmp );
+        }
+    }
+
+    /**
+     * sort n keys, each pass split over the threads.
+     */
+    template< bool Perm, typename K >
+    void radix_sort_parallel( K * & keys, K * & tmp, uint32_t * & perm, uint32_t * & perm_tmp,
+                              std::size_t const n, unsigned const threads )
+    {
+        // the digits for which all keys agree need no pass:
+
+        K all_and = K( ~K( 0 ) ), all_or = K( 0 );
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            all_and &= keys[i];
+            all_or  |= keys[i];
+        }
+        K const varying = K( all_and ^ all_or );
+
+        std::vector<std::size_t> counts( 256 * threads );
+
+        for ( unsigned shift = 0; shift < 8 * sizeof( K ); shift += 8 )
+        {
+            if ( ( ( varying >> shift ) & 0xff ) == 0 )
+                continue;
+
+            K const * const src = keys;
+            std::fill( counts.begin(), counts.end(), std::size_t( 0 ) );
+
+            parallel_for( 0, n, threads, [&]( std::size_t first, std::size_t last, unsigned t )
+            {
+                std::size_t * const c = &counts[ 256 * t ];
+                for ( std::size_t i = first; i < last; ++i )
+                    ++c[ ( src[i] >> shift ) & 0xff ];
+            } );
+
+            // exclusive prefix sum, digit-major and thread-minor, keeps the sort stable:
+
+            std::size_t sum = 0;
+            for ( unsigned b = 0; b < 256; ++b )
+            {
+                for ( unsigned t = 0; t < threads; ++t )
+                {
+                    std::size_t const c = counts[ 256 * t + b ];
+                    counts[ 256 * t + b ] = sum;
+                    sum += c;
+                }
+            }
+
+            K * const dst = tmp;
+            uint32_t const * const psrc = perm;
+            uint32_t * const pdst = perm_tmp;
+
+            parallel_for( 0, n, threads, [&]( std::size_t first, std::size_t last, unsigned t )
+            {
+                radix_scatter<Perm>( src, dst, psrc, pdst, first, last, shift, &counts[ 256 * t ] );
+            } );
+
+            std::swap( keys, tmp );
+            std::swap( perm, perm_tmp );
+        }
+    }
+
+    /**
+     * sort keys, tracking the permutation when Perm; on return 'keys' and
+     * 'perm' point to the buffers that hold the result.
+     */
+    template< bool Perm, typename K >
+    void radix_sort_keys( K * & keys, K * & tmp, uint32_t * & perm, uint32_t * & perm_tmp,
+                          std::size_t const n, unsigned const threads )
+    {
+        if ( threads == 1 )
+            radix_sort_sequential<Perm>( keys, tmp, perm, perm_tmp, n );
+        else
+            radix_sort_parallel<Perm>( keys, tmp, perm, perm_tmp, n, threads );
+    }
+
+    inline unsigned radix_threads( unsigned const threads, std::size_t const n )
+    {
+        // below this size, thread start-up costs more than it gains:
+        return n < 65536 ? 1 : threads ? threads : hardware_threads();
+    }
+
+} // namespace detail
+
+/**
+ * sort underlying values in place.
+ */
+template< typename T >
+void radix_sort_values( span<T> const data, unsigned threads = 1 )
+{
+    typedef radix_key<T> traits;
+    typedef typename traits::type K;
+
+    std::size_t const n = data.size();
+
+    if ( n < 2 )
+        return;
+
+    threads = detail::radix_threads( threads, n );
+
+    std::vector<K> keys( n ), tmp( n );
+
+    for ( std::size_t i = 0; i < n; ++i )
+        keys[i] = traits::to_key( data[i] );
+
+    K * sorted = &keys[0];
+    K * other = &tmp[0];
+    uint32_t * perm = 0;
+    uint32_t * perm_tmp = 0;
+
+    detail::radix_sort_keys<false>( sorted, other, perm, perm_tmp, n, threads );
+
+    for ( std::size_t i = 0; i < n; ++i )
+        data[i] = traits::from_key( sorted[i] );
+}
+
+/**
+ * sort whole values in place by their underlying value.
+ */
+template< typename Q >
+void radix_sort( span<Q> const data, unsigned const threads = 1 )
+{
+    radix_sort_values( values( data ), threads );
+}
+
+template< typename Q, typename A >
+void radix_sort( std::vector<Q,A> & data, unsigned const threads = 1 )
+{
+    radix_sort( make_span( data ), threads );
+}
+
+/**
+ * sort keys in place and permute values alike; stable.
+ */
+template< typename Q, typename V >
+void radix_sort_by_key( span<Q> const keys, span<V> const vals, unsigned threads = 1 )
+{
+    typedef typename Q::value_type T;
+    typedef radix_key<T> traits;
+    typedef typename traits::type K;
+
+    std::size_t const n = keys.size();
+
+    if ( n < 2 )
+        return;
+
+    assert( n == vals.size() && n < 0xffffffffu );
+
+    threads = detail::radix_threads( threads, n );
+
+    span<T> const data = values( keys );
+
+    std::vector<K> k( n ), ktmp( n );
+    std::vector<uint32_t> perm( n ), ptmp( n );
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        k[i] = traits::to_key( data[i] );
+        perm[i] = uint32_t( i );
+    }
+
+    K * sorted = &k[0];
+    K * other = &ktmp[0];
+    uint32_t * order = &perm[0];
+    uint32_t * order_tmp = &ptmp[0];
+
+    detail::radix_sort_keys<true>( sorted, other, order, order_tmp, n, threads );
+
+    std::vector<V> v( vals.begin(), vals.end() );
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        data[i] = traits::from_key( sorted[i] );
+        vals[i] = std::move( v[ order[i] ] );
+    }
+}
+
+template< typename Q, typename QA, typename V, typename VA >
+void radix_sort_by_key( std::vector<Q,QA> & keys, std::vector<V,VA> & vals, unsigned const threads = 1 )
+{
+    radix_sort_by_key( make_span( keys ), make_span( vals ), threads );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_RADIX_SORT_H_INCLUDED
+
+/*
+ * end of file
+ */
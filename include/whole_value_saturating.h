@@ -0,0 +1,292 @@
+/*
+ * whole_value_saturating.h
+ * arithmetic and quantity types whose integer operations saturate.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * saturate_on_overflow is an overflow policy of checked_arithmetic and
+ * checked_quantity (see whole_value_checked.h) that does not report, but
+ * clamps a result that does not fit T to the nearest of T's minimum and
+ * maximum. saturating_arithmetic<T, TG> and saturating_quantity<T, TG> name
+ * the checked types with this policy; create them with
+ * WV_DEFINE_SATURATING_ARITHMETIC_TYPE() and WV_DEFINE_SATURATING_QUANTITY_TYPE().
+ *
+ * Addition and subtraction compute the wrapped result and select the limit
+ * from the sign bits, without branches, as do multiplication and negation;
+ * min / -1 gives max. Division by zero gives max, min or zero, after the
+ * sign of the dividend; a remainder by zero gives zero.
+ *
+ * saturating_shl() and saturating_shr() shift bits types: a left shift that
+ * would lose a set bit gives all ones, and a shift by the width or more is
+ * defined (all ones or zero to the left, zero to the right).
+ *
+ * saturating_add() and saturating_sub() process spans of any integral whole
+ * value type; for 8 and 16-bit underlying types with SSE2 they use the
+ * saturating instructions (paddsb, paddusw, psubsw, ...) on 16 bytes at a
+ * time, and otherwise a branchless loop that the compiler vectorizes.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_SATURATING_H_INCLUDED
+#define G_WV_WHOLE_VALUE_SATURATING_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_checked.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+# include <emmintrin.h>
+# define G_WV_HAVE_SSE2
+#endif
+
+/**
+ * create saturating arithmetic value type.
+ */
+#define WV_DEFINE_SATURATING_ARITHMETIC_TYPE( type_name, underlying_type ) \
+    WV_DEFINE_CHECKED_ARITHMETIC_TYPE( type_name, underlying_type, ::wv::saturate_on_overflow )
+
+/**
+ * create saturating quantity value type.
+ */
+#define WV_DEFINE_SATURATING_QUANTITY_TYPE( type_name, underlying_type ) \
+    WV_DEFINE_CHECKED_QUANTITY_TYPE( type_name, underlying_type, ::wv::saturate_on_overflow )
+
+namespace wv {
+
+/**
+ * overflow policy: clamp the result to the range of the underlying type.
+ */
+struct saturate_on_overflow {};
+
+template< typename T, typename TG >
+using saturating_arithmetic = checked_arithmetic<T, TG, saturate_on_overflow>;
+
+template< typename T, typename TG >
+using saturating_quantity = checked_quantity<T, TG, saturate_on_overflow>;
+
+namespace detail {
+
+    /**
+     * saturating operations on T, without branches on the values.
+     */
+    template< typename T >
+    struct saturate
+    {
+        static_assert( std::is_integral<T>::value, "saturating types need an integral underlying type" );
+
+        typedef typename std::make_unsigned<T>::type U;
+        typedef std::numeric_limits<T> limits;
+
+        static const int sign = std::numeric_limits<U>::digits - 1;
+
+        /**
+         * max if a is not negative as T, min if it is.
+         */
+        static T limit_of( U const a )
+        {
+            return limits::is_signed ? T( U( U( a >> sign ) + U( limits::max() ) ) ) : limits::max();
+        }
+
+        static T add( T const a, T const b )
+        {
+            U const ua = U( a ), ub = U( b ), r = U( ua + ub );
+            if ( !limits::is_signed )
+                return T( r | U( -U( r < ua ) ) );
+            // overflow if a and b have the same sign and r has the other one:
+            U const over = U( U( ( ua ^ r ) & ( ub ^ r ) ) >> sign );
+            return over ? limit_of( ua ) : T( r );
+        }
+
+        static T sub( T const a, T const b )
+        {
+            U const ua = U( a ), ub = U( b ), r = U( ua - ub );
+            if ( !limits::is_signed )
+                return T( r & U( -U( ua >= ub ) ) );
+            // overflow if a and b have different signs and r has b's sign:
+            U const over = U( U( ( ua ^ ub ) & ( ua ^ r ) ) >> sign );
+            return over ? limit_of( ua ) : T( r );
+        }
+
+        static T mul( T const a, T const b )
+        {
+            T r;
+            bool const over = mul_overflow( a, b, r );
+            return over ? limit_of( U( U( a ) ^ U( b ) ) ) : r;
+        }
+
+        static T div( T const a, T const b )
+        {
+            if ( G_WV_UNLIKELY( b == 0 ) )
+                return a == 0 ? T( 0 ) : limit_of( U( a ) );
+            if ( limits::is_signed && G_WV_UNLIKELY( b == T( -1 ) ) )
+                return neg( a );
+            return T( a / b );
+        }
+
+        static T mod( T const a, T const b )
+        {
+            // the remainder of min / -1 is 0, but computing it traps on x86:
+            if ( G_WV_UNLIKELY( b == 0 ) || ( limits::is_signed && b == T( -1 ) ) )
+                return T( 0 );
+            return T( a % b );
+        }
+
+        static T neg( T const a )
+        {
+            return sub( T( 0 ), a );
+        }
+    };
+
+    template< typename T >
+    const int saturate<T>::sign;
+
+    /**
+     * checked operations with the saturate_on_overflow policy.
+     */
+    template< typename T >
+    struct checked_ops< T, saturate_on_overflow > : saturate<T> {};
+
+    /**
+     * r[i] = a[i] + b[i] and r[i] = a[i] - b[i], saturated.
+     */
+    template< typename T >
+    void saturating_add( T const * const a, T const * const b, T * const r, std::size_t const n )
+    {
+        for ( std::size_t i = 0; i < n; ++i )
+            r[i] = saturate<T>::add( a[i], b[i] );
+    }
+
+    template< typename T >
+    void saturating_sub( T const * const a, T const * const b, T * const r, std::size_t const n )
+    {
+        for ( std::size_t i = 0; i < n; ++i )
+            r[i] = saturate<T>::sub( a[i], b[i] );
+    }
+
+#ifdef G_WV_HAVE_SSE2
+
+    /**
+     * 16 bytes at a time with the saturating instruction in op, the rest by f.
+     */
+    template< typename T, typename Op >
+    void saturating_sse2( T const * const a, T const * const b, T * const r, std::size_t const n, Op op, T ( * f )( T, T ) )
+    {
+        std::size_t const lanes = 16 / sizeof( T );
+
+        std::size_t i = 0;
+        for ( ; i + lanes <= n; i += lanes )
+        {
+            __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const *>( a + i ) );
+            __m128i const y = _mm_loadu_si128( reinterpret_cast<__m128i const *>( b + i ) );
+            _mm_storeu_si128( reinterpret_cast<__m128i *>( r + i ), op( x, y ) );
+        }
+        for ( ; i < n; ++i )
+            r[i] = f( a[i], b[i] );
+    }
+
+# define G_WV_SATURATING_SSE2( name, T, instruction, scalar ) \
+    inline void name( T const * const a, T const * const b, T * const r, std::size_t const n ) \
+    { \
+        saturating_sse2( a, b, r, n, []( __m128i x, __m128i y ) { return instruction( x, y ); }, &saturate<T>::scalar ); \
+    }
+
+    G_WV_SATURATING_SSE2( saturating_add, int8_t,   _mm_adds_epi8,  add )
+    G_WV_SATURATING_SSE2( saturating_add, uint8_t,  _mm_adds_epu8,  add )
+    G_WV_SATURATING_SSE2( saturating_add, int16_t,  _mm_adds_epi16, add )
+    G_WV_SATURATING_SSE2( saturating_add, uint16_t, _mm_adds_epu16, add )
+
+    G_WV_SATURATING_SSE2( saturating_sub, int8_t,   _mm_subs_epi8,  sub )
+    G_WV_SATURATING_SSE2( saturating_sub, uint8_t,  _mm_subs_epu8,  sub )
+    G_WV_SATURATING_SSE2( saturating_sub, int16_t,  _mm_subs_epi16, sub )
+    G_WV_SATURATING_SSE2( saturating_sub, uint16_t, _mm_subs_epu16, sub )
+
+# undef G_WV_SATURATING_SSE2
+
+#endif // G_WV_HAVE_SSE2
+
+} // namespace detail
+
+/**
+ * x << n, or all ones if that loses a set bit; n >= 0.
+ */
+template< typename T, typename TG >
+inline bits<T,TG> saturating_shl( bits<T,TG> const & x, int const n )
+{
+    typedef typename std::make_unsigned<T>::type U;
+    int const width = std::numeric_limits<U>::digits;
+
+    assert( n >= 0 && "saturating_shl: negative shift" );
+
+    U const v = U( x.value() );
+    U const ones = U( ~U( 0 ) );
+
+    if ( n >= width )
+        return bits<T,TG>( T( v ? ones : U( 0 ) ) );
+
+    // the bits shifted out, in two steps, as a shift by width is undefined:
+    U const lost = U( U( v >> ( width - 1 - n ) ) >> 1 );
+    return bits<T,TG>( T( lost ? ones : U( v << n ) ) );
+}
+
+/**
+ * x >> n, or zero for n >= the width; n >= 0.
+ */
+template< typename T, typename TG >
+inline bits<T,TG> saturating_shr( bits<T,TG> const & x, int const n )
+{
+    typedef typename std::make_unsigned<T>::type U;
+    int const width = std::numeric_limits<U>::digits;
+
+    assert( n >= 0 && "saturating_shr: negative shift" );
+
+    return bits<T,TG>( T( n >= width ? U( 0 ) : U( U( x.value() ) >> n ) ) );
+}
+
+/**
+ * out[i] = a[i] + b[i], saturated; out may be a or b.
+ */
+template< typename Q1, typename Q2 >
+void saturating_add( span<Q1> const a, span<Q2> const b, span< typename std::remove_const<Q1>::type > const out )
+{
+    typedef typename std::remove_const<Q1>::type V;
+
+    static_assert( std::is_same< V, typename std::remove_const<Q2>::type >::value, "saturating_add: different types" );
+    assert( a.size() == b.size() && a.size() == out.size() && "saturating_add: different sizes" );
+
+    detail::saturating_add( values( span<V const>( a ) ).data(), values( span<V const>( b ) ).data(), values( out ).data(), a.size() );
+}
+
+/**
+ * out[i] = a[i] - b[i], saturated; out may be a or b.
+ */
+template< typename Q1, typename Q2 >
+void saturating_sub( span<Q1> const a, span<Q2> const b, span< typename std::remove_const<Q1>::type > const out )
+{
+    typedef typename std::remove_const<Q1>::type V;
+
+    static_assert( std::is_same< V, typename std::remove_const<Q2>::type >::value, "saturating_sub: different types" );
+    assert( a.size() == b.size() && a.size() == out.size() && "saturating_sub: different sizes" );
+
+    detail::saturating_sub( values( span<V const>( a ) ).data(), values( span<V const>( b ) ).data(), values( out ).data(), a.size() );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_SATURATING_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,244 @@
+/*
+ * whole_value_scan.h
+ * parallel reduction and prefix sums over arrays of whole values.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * reduce(), inclusive_scan() and exclusive_scan() combine whole values with
+ * the operators of their own type, by default operator+, so a scan of Count
+ * yields Count and a type without operator+ does not compile. Any other
+ * associative operation can be passed instead.
+ *
+ * With threads > 1 the span is split like parallel_for() does. A reduction
+ * combines the per-chunk results in chunk order. A scan takes two parallel
+ * passes: the first reduces each chunk, a short sequential pass turns those
+ * totals into chunk offsets, and the second scans each chunk starting from
+ * its offset. The grouping of the operations depends on the thread count,
+ * so floating point results can differ in the last bits between thread
+ * counts; see whole_value_sum.h for a reproducible sum.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_SCAN_H_INCLUDED
+#define G_WV_WHOLE_VALUE_SCAN_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_parallel.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace wv {
+
+/**
+ * x + y, with the operator+ of the whole value type.
+ */
+struct plus
+{
+    template< typename Q >
+    Q operator()( Q const & x, Q const & y ) const { return x + y; }
+};
+
+namespace detail {
+
+    template< typename Q >
+    struct value_of
+    {
+        typedef typename std::remove_const<Q>::type type;
+    };
+
+    /**
+     * R, if Op is an operation rather than a thread count.
+     */
+    template< typename Op, typename R >
+    struct if_operation : std::enable_if< !std::is_arithmetic<Op>::value, R > {};
+
+    template< typename Q, typename Op >
+    Q reduce_range( Q const * const p, std::size_t const first, std::size_t const last, Q init, Op op )
+    {
+        for ( std::size_t i = first; i < last; ++i )
+            init = op( init, p[i] );
+        return init;
+    }
+
+    /**
+     * out[i] = op( acc, in[first..i] ), inclusive.
+     */
+    template< typename Q, typename Op >
+    void scan_range( Q const * const in, Q * const out, std::size_t const first, std::size_t const last, Q acc, Op op )
+    {
+        for ( std::size_t i = first; i < last; ++i )
+        {
+            acc = op( acc, in[i] );
+            out[i] = acc;
+        }
+    }
+
+    /**
+     * out[i] = op( acc, in[first..i) ), exclusive.
+     */
+    template< typename Q, typename Op >
+    void exclusive_scan_range( Q const * const in, Q * const out, std::size_t const first, std::size_t const last, Q acc, Op op )
+    {
+        for ( std::size_t i = first; i < last; ++i )
+        {
+            Q const x = in[i];
+            out[i] = acc;
+            acc = op( acc, x );
+        }
+    }
+
+    /**
+     * the reduction of each chunk, in chunk order.
+     */
+    template< typename Q, typename Op >
+    std::vector<Q> chunk_totals( Q const * const p, std::size_t const n, unsigned const threads, Op op )
+    {
+        std::vector<Q> totals( threads );
+
+        parallel_for( 0, n, threads, [&]( std::size_t first, std::size_t last, unsigned t )
+        {
+            if ( first < last )
+                totals[t] = reduce_range( p, first + 1, last, p[first], op );
+        }, parallel_grain );
+
+        return totals;
+    }
+
+    /**
+     * parallel scan; Inclusive selects the inclusive or exclusive variant.
+     */
+    template< bool Inclusive, typename Q, typename Op >
+    void scan( Q const * const in, Q * const out, std::size_t const n, Q const & init, Op op, unsigned threads )
+    {
+        threads = parallel_threads( threads, n );
+
+        if ( threads == 1 )
+        {
+            if ( Inclusive )
+                scan_range( in, out, 0, n, init, op );
+            else
+                exclusive_scan_range( in, out, 0, n, init, op );
+            return;
+        }
+
+        std::vector<Q> offset = chunk_totals( in, n, threads, op );
+
+        // exclusive scan of the chunk totals gives each chunk's starting value:
+        Q acc = init;
+        for ( unsigned t = 0; t < threads; ++t )
+        {
+            Q const total = offset[t];
+            offset[t] = acc;
+            if ( partition( 0, n, t, threads, parallel_grain ).size() )
+                acc = op( acc, total );
+        }
+
+        parallel_for( 0, n, threads, [&]( std::size_t first, std::size_t last, unsigned t )
+        {
+            if ( Inclusive )
+                scan_range( in, out, first, last, offset[t], op );
+            else
+                exclusive_scan_range( in, out, first, last, offset[t], op );
+        }, parallel_grain );
+    }
+
+} // namespace detail
+
+/**
+ * op( ... op( op( init, a[0] ), a[1] ) ..., a[n-1] ), computed per chunk
+ * when threads > 1; threads 0 means all hardware threads.
+ */
+template< typename Q, typename Op >
+typename detail::if_operation< Op, typename detail::value_of<Q>::type >::type
+reduce( span<Q> const a, typename detail::value_of<Q>::type init, Op op, unsigned threads = 1 )
+{
+    typedef typename detail::value_of<Q>::type V;
+
+    V const * const p = a.data();
+    std::size_t const n = a.size();
+
+    threads = detail::parallel_threads( threads, n );
+
+    if ( threads == 1 )
+        return detail::reduce_range( p, 0, n, init, op );
+
+    std::vector<V> const totals = detail::chunk_totals( p, n, threads, op );
+
+    for ( unsigned t = 0; t < threads; ++t )
+        if ( partition( 0, n, t, threads, detail::parallel_grain ).size() )
+            init = op( init, totals[t] );
+
+    return init;
+}
+
+/**
+ * sum of a, starting from init.
+ */
+template< typename Q >
+typename detail::value_of<Q>::type
+reduce( span<Q> const a, typename detail::value_of<Q>::type const & init = typename detail::value_of<Q>::type(), unsigned const threads = 1 )
+{
+    return reduce( a, init, plus(), threads );
+}
+
+/**
+ * out[i] = init op in[0] op ... op in[i]; out may be in.
+ */
+template< typename Q, typename Op >
+typename detail::if_operation< Op, void >::type
+inclusive_scan( span<Q> const in, span< typename detail::value_of<Q>::type > const out,
+                typename detail::value_of<Q>::type const & init, Op op, unsigned const threads = 1 )
+{
+    assert( in.size() == out.size() && "inclusive_scan: different sizes" );
+    detail::scan<true>( in.data(), out.data(), in.size(), init, op, threads );
+}
+
+/**
+ * out[i] = in[0] + ... + in[i]; out may be in.
+ */
+template< typename Q >
+void inclusive_scan( span<Q> const in, span< typename detail::value_of<Q>::type > const out, unsigned const threads = 1 )
+{
+    inclusive_scan( in, out, typename detail::value_of<Q>::type(), plus(), threads );
+}
+
+/**
+ * out[i] = init op in[0] op ... op in[i-1], out[0] = init; out may be in.
+ */
+template< typename Q, typename Op >
+typename detail::if_operation< Op, void >::type
+exclusive_scan( span<Q> const in, span< typename detail::value_of<Q>::type > const out,
+                typename detail::value_of<Q>::type const & init, Op op, unsigned const threads = 1 )
+{
+    assert( in.size() == out.size() && "exclusive_scan: different sizes" );
+    detail::scan<false>( in.data(), out.data(), in.size(), init, op, threads );
+}
+
+/**
+ * out[i] = init + in[0] + ... + in[i-1]; out may be in.
+ */
+template< typename Q >
+void exclusive_scan( span<Q> const in, span< typename detail::value_of<Q>::type > const out,
+                     typename detail::value_of<Q>::type const & init = typename detail::value_of<Q>::type(), unsigned const threads = 1 )
+{
+    exclusive_scan( in, out, init, plus(), threads );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_SCAN_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,277 @@
+/*
+ * whole_value_search.h
+ * search in sorted arrays of whole values.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * All functions return the position of the first element that is not less
+ * than the key, like std::lower_bound(), as an index into the sorted span.
+ *
+ * - branchless_lower_bound(): binary search whose loop body selects the
+ *   next half arithmetically instead of with a branch, so it does not
+ *   suffer from mispredictions.
+ * - linear_lower_bound(): counts the elements less than the key in a loop
+ *   without early exit that the compiler vectorizes (GCC and Clang at -O3);
+ *   fastest for short arrays (up to about 32 elements).
+ * - eytzinger: a copy of the sorted array in breadth-first (Eytzinger) order.
+ *   Searching it touches consecutive cache lines near the root. The tree is
+ *   aligned to a 64-byte cache line, so the descendants of a node
+ *   log2( 64 / sizeof( value_type ) ) levels down fill exactly one line,
+ *   which the search prefetches; it is the fastest layout for arrays larger
+ *   than the caches.
+ *
+ * The comparisons are on the underlying values, so they work for every whole
+ * value type with an ordered value_type, also for those without operator<.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_SEARCH_H_INCLUDED
+#define G_WV_WHOLE_VALUE_SEARCH_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_span.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#if defined( __GNUC__ )
+# define G_WV_PREFETCH( p ) __builtin_prefetch( p )
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+# include <xmmintrin.h>
+# define G_WV_PREFETCH( p ) _mm_prefetch( reinterpret_cast<char const *>( p ), _MM_HINT_T0 )
+#else
+# define G_WV_PREFETCH( p ) ( (void) ( p ) )
+#endif
+
+namespace wv {
+
+/**
+ * index of the first element of sorted a not less than key; branchless.
+ */
+template< typename Q >
+std::size_t branchless_lower_bound( span<Q const> const a, Q const & key )
+{
+    typedef typename Q::value_type T;
+
+    T const * base = values( a ).data();
+    T const k = key.value();
+    std::size_t n = a.size();
+
+    if ( n == 0 )
+        return 0;
+
+    while ( n > 1 )
+    {
+        std::size_t const half = n / 2;
+        // arithmetic instead of ?: keeps compilers from emitting a branch:
+        base += half * std::size_t( base[ half - 1 ] < k );
+        n -= half;
+    }
+
+    return ( base - values( a ).data() ) + ( *base < k );
+}
+
+/**
+ * index of the first element of sorted a not less than key; vectorizable
+ * count, for short arrays.
+ */
+template< typename Q >
+std::size_t linear_lower_bound( span<Q const> const a, Q const & key )
+{
+    typedef typename Q::value_type T;
+
+    T const * const p = values( a ).data();
+    T const k = key.value();
+    std::size_t const n = a.size();
+
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < n; ++i )
+        count += p[i] < k;
+
+    return count;
+}
+
+/**
+ * sorted values in Eytzinger (breadth-first) layout, with lower_bound().
+ */
+template< typename Q >
+class eytzinger
+{
+public:
+    typedef Q value_type;
+    typedef typename Q::value_type underlying_type;
+
+    /**
+     * cache line size, and the values in a line: the descendants of a node
+     * that many levels down are consecutive, and start a line when the tree
+     * (its position 0) starts one.
+     */
+    static const std::size_t line_size = 64;
+    static const std::size_t line_values = sizeof( underlying_type ) < line_size ? line_size / sizeof( underlying_type ) : 1;
+
+    eytzinger() : m_storage( line_values + 1 ), m_offset( offset( m_storage ) ), m_nodes( 1 ), m_index( 1, 0 ) {}
+
+    /**
+     * build from sorted values.
+     */
+    explicit eytzinger( span<Q const> const sorted )
+    : m_storage( sorted.size() + line_values + 1 ), m_offset( offset( m_storage ) ), m_nodes( sorted.size() + 1 ), m_index( sorted.size() + 1 )
+    {
+        std::size_t i = 0;
+        build( values( sorted ).data(), i, 1 );
+
+        // position 0 is the 'not found' sentinel:
+        m_index[0] = sorted.size();
+    }
+
+    /**
+     * copy, aligned anew.
+     */
+    eytzinger( eytzinger const & other )
+    : m_storage( other.m_storage.size() ), m_offset( offset( m_storage ) ), m_nodes( other.m_nodes ), m_index( other.m_index )
+    {
+        std::copy( other.tree(), other.tree() + m_nodes, tree() );
+    }
+
+    eytzinger( eytzinger && other )
+    : m_storage( std::move( other.m_storage ) ), m_offset( other.m_offset ), m_nodes( other.m_nodes ), m_index( std::move( other.m_index ) ) {}
+
+    eytzinger & operator=( eytzinger other )
+    {
+        swap( *this, other );
+        return *this;
+    }
+
+    friend void swap( eytzinger & first, eytzinger & second )
+    {
+        using std::swap;
+        swap( first.m_storage, second.m_storage );
+        swap( first.m_offset, second.m_offset );
+        swap( first.m_nodes, second.m_nodes );
+        swap( first.m_index, second.m_index );
+    }
+
+    std::size_t size() const { return m_nodes - 1; }
+
+    /**
+     * index in the original sorted array of the first element not less than
+     * key; size() if there is none.
+     */
+    std::size_t lower_bound( Q const & key ) const
+    {
+        return m_index[ lower_bound_node( key.value() ) ];
+    }
+
+private:
+    /**
+     * values to skip at the front of storage to align the tree to a line.
+     */
+    static std::size_t offset( std::vector<underlying_type> const & storage )
+    {
+        std::size_t const misalignment = reinterpret_cast<std::size_t>( storage.data() ) % line_size;
+        return misalignment && misalignment % sizeof( underlying_type ) == 0 ? ( line_size - misalignment ) / sizeof( underlying_type ) : 0;
+    }
+
+    underlying_type * tree() { return m_storage.data() + m_offset; }
+    underlying_type const * tree() const { return m_storage.data() + m_offset; }
+
+    /**
+     * in-order traversal of the implicit tree fills it with the sorted values.
+     */
+    void build( underlying_type const * const sorted, std::size_t & i, std::size_t const k )
+    {
+        if ( k < m_nodes )
+        {
+            build( sorted, i, 2 * k );
+            tree()[k] = sorted[i];
+            m_index[k] = i++;
+            build( sorted, i, 2 * k + 1 );
+        }
+    }
+
+    std::size_t lower_bound_node( underlying_type const x ) const
+    {
+        underlying_type const * const t = tree();
+        std::size_t const n = m_nodes;
+
+        // prefetch the cache line of the descendants log2( line_values ) levels down:
+        std::size_t k = 1;
+        while ( k < n )
+        {
+            G_WV_PREFETCH( t + line_values * k );
+            k = 2 * k + ( t[k] < x );
+        }
+
+        // the path turned right after the answer: undo those turns and one more.
+        k >>= trailing_ones( k ) + 1;
+        return k;
+    }
+
+    static unsigned trailing_ones( std::size_t k )
+    {
+#if defined( __GNUC__ )
+        return static_cast<unsigned>( __builtin_ctzll( ~static_cast<unsigned long long>( k ) ) );
+#else
+        unsigned n = 0;
+        for ( ; k & 1; k >>= 1 )
+            ++n;
+        return n;
+#endif
+    }
+
+    std::vector<underlying_type> m_storage;
+    std::size_t m_offset;
+    std::size_t m_nodes;
+    std::vector<std::size_t> m_index;
+};
+
+template< typename Q >
+const std::size_t eytzinger<Q>::line_size;
+
+template< typename Q >
+const std::size_t eytzinger<Q>::line_values;
+
+/**
+ * index of the first element not less than key; picks the linear or the
+ * branchless search by array size.
+ */
+template< typename Q >
+std::size_t lower_bound( span<Q const> const a, Q const & key )
+{
+    return a.size() <= 32 ? linear_lower_bound( a, key ) : branchless_lower_bound( a, key );
+}
+
+template< typename Q, typename A >
+std::size_t branchless_lower_bound( std::vector<Q,A> const & a, Q const & key )
+{
+    return branchless_lower_bound( make_span( a ), key );
+}
+
+template< typename Q, typename A >
+std::size_t linear_lower_bound( std::vector<Q,A> const & a, Q const & key )
+{
+    return linear_lower_bound( make_span( a ), key );
+}
+
+template< typename Q, typename A >
+std::size_t lower_bound( std::vector<Q,A> const & a, Q const & key )
+{
+    return lower_bound( make_span( a ), key );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_SEARCH_H_INCLUDED
+
+/*
+ * end of file
+ */
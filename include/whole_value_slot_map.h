@@ -0,0 +1,312 @@
+/*
+ * whole_value_slot_map.h
+ * generational slot map keyed by whole value handles.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * slot_map<EntityId, T> hands out EntityId handles, for example
+ * whole_value<uint32_t, EntityId_tag>. The handle word holds a slot index in
+ * its low IndexBits bits and the slot's generation in the remaining bits.
+ * Erasing an element bumps the generation of its slot, so an old handle no
+ * longer matches and is detected as stale.
+ *
+ * Insert, erase and lookup are O(1): a lookup is two array accesses and a
+ * compare. Values are kept densely in insertion order, modulo erasures that
+ * move the last value into the hole, so iterating over them is a plain array
+ * scan. Generation 0 is never used, hence a default-constructed handle is
+ * never valid.
+ *
+ * Generations wrap: after 2^(bits - IndexBits) - 1 reuses of one slot, a
+ * handle kept from the first use matches again. Choose IndexBits to leave
+ * enough generation bits for the reuse rate of the application.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_SLOT_MAP_H_INCLUDED
+#define G_WV_WHOLE_VALUE_SLOT_MAP_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace wv {
+
+/**
+ * default number of index bits: 24 of 32, half of a wider handle word.
+ */
+template< typename Word >
+struct slot_map_index_bits
+{
+    static const unsigned value = sizeof( Word ) * 8 == 32 ? 24 : sizeof( Word ) * 4;
+};
+
+/**
+ * dense map from generational handles to values of type T.
+ */
+template< typename Handle, typename T, unsigned IndexBits = slot_map_index_bits< typename Handle::value_type >::value >
+class slot_map
+{
+public:
+    typedef Handle handle_type;
+    typedef T value_type;
+    typedef typename Handle::value_type word_type;
+    typedef std::size_t size_type;
+    typedef typename std::vector<T>::iterator iterator;
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    static_assert( !std::numeric_limits<word_type>::is_signed, "handle word must be unsigned" );
+    static_assert( IndexBits > 0 && IndexBits < sizeof( word_type ) * 8, "handle word needs index and generation bits" );
+
+    static const word_type index_mask = ( word_type( 1 ) << IndexBits ) - 1;
+    static const word_type generation_mask = word_type( ~word_type( 0 ) ) >> IndexBits;
+
+    slot_map() : m_free( no_slot ) {}
+
+    size_type size() const { return m_values.size(); }
+    bool empty() const { return m_values.empty(); }
+
+    /**
+     * largest number of elements that can be addressed by a handle.
+     */
+    static size_type max_size() { return size_type( index_mask ); }
+
+    void reserve( size_type const n )
+    {
+        m_values.reserve( n );
+        m_slot_of.reserve( n );
+        m_slots.reserve( n );
+    }
+
+    void clear()
+    {
+        while ( !m_values.empty() )
+            erase_dense( m_values.size() - 1 );
+    }
+
+    /**
+     * store x, return its handle.
+     */
+    Handle insert( T const & x )
+    {
+        return emplace( x );
+    }
+
+    Handle insert( T && x )
+    {
+        return emplace( std::move( x ) );
+    }
+
+    template< typename... Args >
+    Handle emplace( Args &&... args )
+    {
+        word_type const s = acquire_slot();
+
+        try
+        {
+            m_values.emplace_back( std::forward<Args>( args )... );
+            m_slot_of.push_back( s );
+        }
+        catch ( ... )
+        {
+            if ( m_values.size() > m_slot_of.size() )
+                m_values.pop_back();
+            release_slot( s );
+            throw;
+        }
+        m_slots[s].dense = word_type( m_values.size() - 1 );
+
+        return make_handle( s, m_slots[s].generation );
+    }
+
+    /**
+     * remove the element of h; false if h is stale.
+     */
+    bool erase( Handle const h )
+    {
+        slot const * const p = find_slot( h );
+
+        if ( !p )
+            return false;
+
+        erase_dense( p->dense );
+        return true;
+    }
+
+    bool contains( Handle const h ) const
+    {
+        return find_slot( h ) != 0;
+    }
+
+    /**
+     * pointer to the element of h, null if h is stale.
+     */
+    T * find( Handle const h )
+    {
+        slot const * const p = find_slot( h );
+        return p ? &m_values[ p->dense ] : 0;
+    }
+
+    T const * find( Handle const h ) const
+    {
+        slot const * const p = find_slot( h );
+        return p ? &m_values[ p->dense ] : 0;
+    }
+
+    /**
+     * element of h, which must be valid.
+     */
+    T & operator[]( Handle const h )
+    {
+        assert( contains( h ) && "slot_map: stale handle" );
+        return m_values[ m_slots[ index_of( h ) ].dense ];
+    }
+
+    T const & operator[]( Handle const h ) const
+    {
+        assert( contains( h ) && "slot_map: stale handle" );
+        return m_values[ m_slots[ index_of( h ) ].dense ];
+    }
+
+    /**
+     * element of h; throws std::out_of_range if h is stale.
+     */
+    T & at( Handle const h )
+    {
+        T * const p = find( h );
+        if ( !p )
+            throw std::out_of_range( "slot_map: stale handle" );
+        return *p;
+    }
+
+    /**
+     * handle of the element at position i of the dense value array.
+     */
+    Handle handle_at( size_type const i ) const
+    {
+        word_type const s = m_slot_of[i];
+        return make_handle( s, m_slots[s].generation );
+    }
+
+    iterator begin() { return m_values.begin(); }
+    iterator end() { return m_values.end(); }
+    const_iterator begin() const { return m_values.begin(); }
+    const_iterator end() const { return m_values.end(); }
+
+    /**
+     * the dense value array.
+     */
+    span<T> values() { return make_span( m_values ); }
+    span<T const> values() const { return make_span( m_values ); }
+
+    static word_type index_of( Handle const h ) { return h.value() & index_mask; }
+    static word_type generation_of( Handle const h ) { return ( h.value() >> IndexBits ) & generation_mask; }
+
+private:
+    static const word_type no_slot = index_mask;
+
+    struct slot
+    {
+        word_type dense;        // position in m_values, or next free slot
+        word_type generation;
+    };
+
+    static Handle make_handle( word_type const s, word_type const generation )
+    {
+        return Handle( word_type( generation << IndexBits ) | s );
+    }
+
+    slot const * find_slot( Handle const h ) const
+    {
+        word_type const s = index_of( h );
+
+        if ( s >= m_slots.size() )
+            return 0;
+
+        slot const & x = m_slots[s];
+
+        return x.generation == generation_of( h ) ? &x : 0;
+    }
+
+    word_type acquire_slot()
+    {
+        if ( m_free != no_slot )
+        {
+            word_type const s = m_free;
+            m_free = m_slots[s].dense;
+            return s;
+        }
+
+        if ( m_slots.size() >= max_size() )
+            throw std::length_error( "slot_map: handle index space exhausted" );
+
+        slot const x = { 0, 1 };
+        m_slots.push_back( x );
+        return word_type( m_slots.size() - 1 );
+    }
+
+    /**
+     * put slot s on the free list.
+     */
+    void release_slot( word_type const s )
+    {
+        m_slots[s].dense = m_free;
+        m_free = s;
+    }
+
+    void erase_dense( size_type const i )
+    {
+        word_type const s = m_slot_of[i];
+        size_type const last = m_values.size() - 1;
+
+        if ( i != last )
+        {
+            m_values[i] = std::move( m_values[last] );
+            m_slot_of[i] = m_slot_of[last];
+            m_slots[ m_slot_of[i] ].dense = word_type( i );
+        }
+
+        m_values.pop_back();
+        m_slot_of.pop_back();
+
+        slot & x = m_slots[s];
+        x.generation = ( x.generation + 1 ) & generation_mask;
+        if ( x.generation == 0 )
+            x.generation = 1;
+        release_slot( s );
+    }
+
+    std::vector<T> m_values;
+    std::vector<word_type> m_slot_of;
+    std::vector<slot> m_slots;
+    word_type m_free;
+};
+
+template< typename Handle, typename T, unsigned IndexBits >
+const typename slot_map<Handle, T, IndexBits>::word_type slot_map<Handle, T, IndexBits>::index_mask;
+
+template< typename Handle, typename T, unsigned IndexBits >
+const typename slot_map<Handle, T, IndexBits>::word_type slot_map<Handle, T, IndexBits>::generation_mask;
+
+template< typename Handle, typename T, unsigned IndexBits >
+const typename slot_map<Handle, T, IndexBits>::word_type slot_map<Handle, T, IndexBits>::no_slot;
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_SLOT_MAP_H_INCLUDED
+
+/*
+ * end of file
+ */
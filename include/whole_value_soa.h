@@ -0,0 +1,398 @@
+/*
+ * whole_value_soa.h
+ * structure-of-arrays container for records of whole value fields.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * soa<Price, Volume, OrderId> stores each field in its own contiguous
+ * array, so a scan over one field only reads that field's memory. A field is
+ * selected by its type, get<Price>(), or, when a type occurs more than once,
+ * by its position, get<0>(). Rows are accessed through a proxy that refers
+ * to one element of each array.
+ *
+ * The iterators are random access iterators with the proxy as reference,
+ * like those of std::vector<bool>. Algorithms that only read rows, such as
+ * std::lower_bound() or std::find_if(), work on them; a proxy cannot be
+ * assigned, so algorithms that move rows, such as std::sort(), do not
+ * compile: sort a permutation of row indices instead.
+ *
+ * The arrays are vectors that are resized together, so push_back(), reserve()
+ * and erase() cost what the vector operations cost, once per field. If a
+ * field's copy throws in push_back(), the columns already extended are popped
+ * again, so the soa is left as it was.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_SOA_H_INCLUDED
+#define G_WV_WHOLE_VALUE_SOA_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_span.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace wv {
+
+namespace detail {
+
+    template< std::size_t... I > struct indices {};
+
+    template< std::size_t N, std::size_t... I >
+    struct make_indices : make_indices< N - 1, N - 1, I... > {};
+
+    template< std::size_t... I >
+    struct make_indices< 0, I... > { typedef indices< I... > type; };
+
+    /**
+     * position of the first T in Ts; compile-time error if absent.
+     */
+    template< typename T, typename... Ts > struct index_of;
+
+    template< typename T, typename... Ts >
+    struct index_of< T, T, Ts... > { static const std::size_t value = 0; };
+
+    template< typename T, typename U, typename... Ts >
+    struct index_of< T, U, Ts... > { static const std::size_t value = 1 + index_of< T, Ts... >::value; };
+
+    /**
+     * evaluate a pack expansion for its side effects.
+     */
+    inline void swallow( std::initializer_list<int> ) {}
+
+} // namespace detail
+
+template< typename... Fields > class soa;
+
+/**
+ * proxy for row i of a soa; S is soa<...> or soa<...> const.
+ */
+template< typename S >
+class soa_row
+{
+public:
+    typedef typename S::size_type size_type;
+
+    soa_row( S & s, size_type const i ) : m_soa( &s ), m_index( i ) {}
+
+    soa_row( soa_row const & other ) : m_soa( other.m_soa ), m_index( other.m_index ) {}
+
+    /**
+     * the row of a non-const soa as a row of a const one.
+     */
+    template< typename T, typename = typename std::enable_if< std::is_same< S, T const >::value >::type >
+    soa_row( soa_row<T> const & other ) : m_soa( other.m_soa ), m_index( other.m_index ) {}
+
+    size_type index() const { return m_index; }
+
+    template< typename F >
+    auto get() const -> decltype( std::declval<S &>().template column<F>()[0] )
+    {
+        return m_soa->template column<F>()[ m_index ];
+    }
+
+    template< std::size_t I >
+    auto get() const -> decltype( std::declval<S &>().template column<I>()[0] )
+    {
+        return m_soa->template column<I>()[ m_index ];
+    }
+
+private:
+    template< typename > friend class soa_row;
+
+    // a proxy refers to its row; assigning one would not copy the fields:
+    soa_row & operator=( soa_row const & );
+
+    S * m_soa;
+    size_type m_index;
+};
+
+/**
+ * pointer-like holder of a row proxy, for the iterator's operator->.
+ */
+template< typename S >
+class soa_row_pointer
+{
+public:
+    explicit soa_row_pointer( soa_row<S> const & row ) : m_row( row ) {}
+
+    soa_row<S> const * operator->() const { return &m_row; }
+
+private:
+    soa_row<S> m_row;
+};
+
+template< typename F, typename S >
+inline auto get( soa_row<S> const & row ) -> decltype( row.template get<F>() )
+{
+    return row.template get<F>();
+}
+
+template< std::size_t I, typename S >
+inline auto get( soa_row<S> const & row ) -> decltype( row.template get<I>() )
+{
+    return row.template get<I>();
+}
+
+/**
+ * random access iterator over the rows of a soa.
+ */
+template< typename S >
+class soa_iterator
+{
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef soa_row<S> value_type;
+    typedef soa_row<S> reference;
+    typedef std::ptrdiff_t difference_type;
+    typedef soa_row_pointer<S> pointer;
+
+    soa_iterator() : m_soa( 0 ), m_index( 0 ) {}
+
+    soa_iterator( S & s, std::size_t const i ) : m_soa( &s ), m_index( i ) {}
+
+    /**
+     * iterator as const_iterator.
+     */
+    template< typename T, typename = typename std::enable_if< std::is_same< S, T const >::value >::type >
+    soa_iterator( soa_iterator<T> const & other ) : m_soa( other.m_soa ), m_index( other.m_index ) {}
+
+    reference operator*() const { return reference( *m_soa, m_index ); }
+    pointer operator->() const { return pointer( **this ); }
+    reference operator[]( difference_type const n ) const { return reference( *m_soa, m_index + n ); }
+
+    soa_iterator & operator++() { ++m_index; return *this; }
+    soa_iterator & operator--() { --m_index; return *this; }
+    soa_iterator operator++( int ) { soa_iterator tmp(*this); ++m_index; return tmp; }
+    soa_iterator operator--( int ) { soa_iterator tmp(*this); --m_index; return tmp; }
+
+    soa_iterator & operator+=( difference_type const n ) { m_index += n; return *this; }
+    soa_iterator & operator-=( difference_type const n ) { m_index -= n; return *this; }
+
+    friend soa_iterator operator+( soa_iterator x, difference_type const n ) { return x += n; }
+    friend soa_iterator operator+( difference_type const n, soa_iterator x ) { return x += n; }
+    friend soa_iterator operator-( soa_iterator x, difference_type const n ) { return x -= n; }
+
+    friend difference_type operator-( soa_iterator const & x, soa_iterator const & y )
+    {
+        return difference_type( x.m_index ) - difference_type( y.m_index );
+    }
+
+    friend bool operator==( soa_iterator const & x, soa_iterator const & y ) { return x.m_index == y.m_index; }
+    friend bool operator!=( soa_iterator const & x, soa_iterator const & y ) { return x.m_index != y.m_index; }
+    friend bool operator< ( soa_iterator const & x, soa_iterator const & y ) { return x.m_index <  y.m_index; }
+    friend bool operator> ( soa_iterator const & x, soa_iterator const & y ) { return x.m_index >  y.m_index; }
+    friend bool operator<=( soa_iterator const & x, soa_iterator const & y ) { return x.m_index <= y.m_index; }
+    friend bool operator>=( soa_iterator const & x, soa_iterator const & y ) { return x.m_index >= y.m_index; }
+
+private:
+    template< typename > friend class soa_iterator;
+
+    S * m_soa;
+    std::size_t m_index;
+};
+
+/**
+ * container that stores each field of its records in a separate array.
+ */
+template< typename... Fields >
+class soa
+{
+public:
+    typedef std::tuple< Fields... > value_type;
+    typedef std::size_t size_type;
+    typedef soa_row< soa > reference;
+    typedef soa_row< soa const > const_reference;
+    typedef soa_iterator< soa > iterator;
+    typedef soa_iterator< soa const > const_iterator;
+
+    static const std::size_t field_count = sizeof...( Fields );
+
+    template< std::size_t I >
+    struct field { typedef typename std::tuple_element< I, value_type >::type type; };
+
+    soa() {}
+
+    /**
+     * create n rows of default-constructed fields.
+     */
+    explicit soa( size_type const n ) { resize( n ); }
+
+    size_type size() const { return std::get<0>( m_columns ).size(); }
+    size_type capacity() const { return std::get<0>( m_columns ).capacity(); }
+    bool empty() const { return size() == 0; }
+
+    void reserve( size_type const n )
+    {
+        for_each_column( reserve_f( n ), indices() );
+    }
+
+    void resize( size_type const n )
+    {
+        for_each_column( resize_f( n ), indices() );
+    }
+
+    void clear()
+    {
+        for_each_column( clear_f(), indices() );
+    }
+
+    void push_back( Fields const &... fields )
+    {
+        push_back( indices(), fields... );
+    }
+
+    void push_back( value_type const & row )
+    {
+        push_back_tuple( row, indices() );
+    }
+
+    void pop_back()
+    {
+        for_each_column( pop_back_f(), indices() );
+    }
+
+    /**
+     * remove row i, keep the order of the remaining rows; O(size() - i).
+     */
+    void erase( size_type const i )
+    {
+        for_each_column( erase_f( i ), indices() );
+    }
+
+    /**
+     * remove row i by moving the last row into its place; O(1).
+     */
+    void erase_unordered( size_type const i )
+    {
+        for_each_column( erase_unordered_f( i ), indices() );
+    }
+
+    reference operator[]( size_type const i ) { return reference( *this, i ); }
+    const_reference operator[]( size_type const i ) const { return const_reference( *this, i ); }
+
+    reference back() { return reference( *this, size() - 1 ); }
+    const_reference back() const { return const_reference( *this, size() - 1 ); }
+
+    iterator begin() { return iterator( *this, 0 ); }
+    iterator end() { return iterator( *this, size() ); }
+    const_iterator begin() const { return const_iterator( *this, 0 ); }
+    const_iterator end() const { return const_iterator( *this, size() ); }
+
+    /**
+     * contiguous array of field F, or of the field at position I.
+     */
+    template< typename F >
+    span<F> column() { return column< detail::index_of< F, Fields... >::value >(); }
+
+    template< typename F >
+    span<F const> column() const { return column< detail::index_of< F, Fields... >::value >(); }
+
+    template< std::size_t I >
+    span< typename field<I>::type > column()
+    {
+        return make_span( std::get<I>( m_columns ) );
+    }
+
+    template< std::size_t I >
+    span< typename field<I>::type const > column() const
+    {
+        return make_span( std::get<I>( m_columns ) );
+    }
+
+    friend void swap( soa & first, soa & second )
+    {
+        first.m_columns.swap( second.m_columns );
+    }
+
+private:
+    typedef typename detail::make_indices< sizeof...( Fields ) >::type indices;
+
+    template< typename F, std::size_t... I >
+    void for_each_column( F f, detail::indices< I... > )
+    {
+        detail::swallow( { ( f( std::get<I>( m_columns ) ), 0 )... } );
+    }
+
+    template< std::size_t... I >
+    void push_back( detail::indices< I... >, Fields const &... fields )
+    {
+        // on an exception, pop the columns already pushed, so all keep size()
+        std::size_t pushed = 0;
+        try
+        {
+            detail::swallow( { ( std::get<I>( m_columns ).push_back( fields ), ++pushed, 0 )... } );
+        }
+        catch ( ... )
+        {
+            detail::swallow( { ( I < pushed ? std::get<I>( m_columns ).pop_back() : void(), 0 )... } );
+            throw;
+        }
+    }
+
+    template< std::size_t... I >
+    void push_back_tuple( value_type const & row, detail::indices< I... > )
+    {
+        push_back( std::get<I>( row )... );
+    }
+
+    struct reserve_f
+    {
+        explicit reserve_f( size_type n ) : n( n ) {}
+        template< typename V > void operator()( V & v ) const { v.reserve( n ); }
+        size_type n;
+    };
+
+    struct resize_f
+    {
+        explicit resize_f( size_type n ) : n( n ) {}
+        template< typename V > void operator()( V & v ) const { v.resize( n ); }
+        size_type n;
+    };
+
+    struct clear_f
+    {
+        template< typename V > void operator()( V & v ) const { v.clear(); }
+    };
+
+    struct pop_back_f
+    {
+        template< typename V > void operator()( V & v ) const { v.pop_back(); }
+    };
+
+    struct erase_f
+    {
+        explicit erase_f( size_type i ) : i( i ) {}
+        template< typename V > void operator()( V & v ) const { v.erase( v.begin() + i ); }
+        size_type i;
+    };
+
+    struct erase_unordered_f
+    {
+        explicit erase_unordered_f( size_type i ) : i( i ) {}
+        template< typename V > void operator()( V & v ) const { v[i] = v.back(); v.pop_back(); }
+        size_type i;
+    };
+
+    std::tuple< std::vector<Fields>... > m_columns;
+};
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_SOA_H_INCLUDED
+
+/*
+ * end of file
+ */
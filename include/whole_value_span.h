@@ -0,0 +1,142 @@
+/*
+ * whole_value_span.h
+ * non-owning view of a contiguous sequence of (whole) values.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * span<Q> is what the bulk kernels of the extension headers take and hand
+ * out. values() reinterprets a span of whole values as a span of their
+ * underlying values, so a loop over it is a loop over plain doubles or ints
+ * that the compiler can vectorize. This relies on a whole value having the
+ * size and layout of its single value_type member, which is checked.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_SPAN_H_INCLUDED
+#define G_WV_WHOLE_VALUE_SPAN_H_INCLUDED
+
+#include "whole_value.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace wv {
+
+/**
+ * view of n contiguous elements of type T.
+ */
+template< typename T >
+class span
+{
+public:
+    typedef T element_type;
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef T * iterator;
+
+    span() : m_data( 0 ), m_size( 0 ) {}
+
+    span( T * const data, size_type const size ) : m_data( data ), m_size( size ) {}
+
+    /**
+     * span<T const> from span<T>.
+     */
+    template< typename U >
+    span( span<U> const & other ) : m_data( other.data() ), m_size( other.size() ) {}
+
+    T * data() const { return m_data; }
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    iterator begin() const { return m_data; }
+    iterator end() const { return m_data + m_size; }
+
+    T & operator[]( size_type const i ) const { return m_data[i]; }
+
+    T & front() const { return m_data[0]; }
+    T & back() const { return m_data[m_size - 1]; }
+
+    span first( size_type const n ) const { return span( m_data, n ); }
+    span last( size_type const n ) const { return span( m_data + m_size - n, n ); }
+
+    span subspan( size_type const offset, size_type const n ) const
+    {
+        return span( m_data + offset, n );
+    }
+
+private:
+    T * m_data;
+    size_type m_size;
+};
+
+/**
+ * span of the elements of a vector or an array.
+ */
+template< typename T, typename A >
+inline span<T> make_span( std::vector<T,A> & v )
+{
+    return span<T>( v.empty() ? 0 : &v[0], v.size() );
+}
+
+template< typename T, typename A >
+inline span<T const> make_span( std::vector<T,A> const & v )
+{
+    return span<T const>( v.empty() ? 0 : &v[0], v.size() );
+}
+
+template< typename T, std::size_t N >
+inline span<T> make_span( T (&a)[N] )
+{
+    return span<T>( a, N );
+}
+
+template< typename T >
+inline span<T> make_span( T * const data, std::size_t const size )
+{
+    return span<T>( data, size );
+}
+
+/**
+ * view whole values as their underlying values.
+ */
+template< typename Q >
+inline span<typename Q::value_type> values( span<Q> const & s )
+{
+    static_assert( sizeof( Q ) == sizeof( typename Q::value_type ), "whole value must have the size of its value_type" );
+
+    return span<typename Q::value_type>( reinterpret_cast<typename Q::value_type *>( s.data() ), s.size() );
+}
+
+template< typename Q >
+inline span<typename Q::value_type const> values( span<Q const> const & s )
+{
+    static_assert( sizeof( Q ) == sizeof( typename Q::value_type ), "whole value must have the size of its value_type" );
+
+    return span<typename Q::value_type const>( reinterpret_cast<typename Q::value_type const *>( s.data() ), s.size() );
+}
+
+/**
+ * view underlying values as whole values of type Q.
+ */
+template< typename Q >
+inline span<Q> as_whole_values( span<typename Q::value_type> const & s )
+{
+    static_assert( sizeof( Q ) == sizeof( typename Q::value_type ), "whole value must have the size of its value_type" );
+
+    return span<Q>( reinterpret_cast<Q *>( s.data() ), s.size() );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_SPAN_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,295 @@
+/*
+ * whole_value_sum.h
+ * reproducible and compensated summation of floating point whole values.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * reproducible_sum() gives the same bits for the same values in the same
+ * order, whatever the number of threads. It pre-rounds: a first pass finds
+ * the largest magnitude, which fixes a ladder of boundaries that depends on
+ * that magnitude and the number of values only. Every value is split along
+ * these boundaries into parts that are exact multiples of the boundary's
+ * unit, so the parts of one level add up without rounding error in any
+ * order. The final result is the sum of the level totals, largest first.
+ * With three levels of 53 - log2(n) bits each, the error is the rounding of
+ * the final additions of the level totals, plus at most
+ * n * max|x| * 2^(3 * log2(n) - 158) for the parts below the lowest level,
+ * which are dropped. That second term does not shrink with the sum, so for
+ * a sum that cancels to near zero it may exceed the error of a plain sum.
+ * Infinite and NaN values give the plain sum.
+ *
+ * compensated_sum() is Neumaier's variant of Kahan summation, per chunk,
+ * with the chunk results combined likewise. It is accurate but, like a
+ * plain parallel sum, depends on the chunking.
+ *
+ * Both rely on IEEE-754 double arithmetic without reassociation: do not
+ * compile with -ffast-math (GCC, Clang) or /fp:fast (MSVC). float values
+ * are summed as double.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_SUM_H_INCLUDED
+#define G_WV_WHOLE_VALUE_SUM_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_parallel.h"
+#include "whole_value_span.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace wv {
+
+namespace detail {
+
+    // number of pre-rounding levels:
+    static const int sum_levels = 3;
+
+    /**
+     * Neumaier: add x to sum, keeping the lost low-order part in comp.
+     */
+    inline void neumaier_add( double & sum, double & comp, double const x )
+    {
+        double const t = sum + x;
+        if ( std::fabs( sum ) >= std::fabs( x ) )
+            comp += ( sum - t ) + x;
+        else
+            comp += ( x - t ) + sum;
+        sum = t;
+    }
+
+    /**
+     * largest magnitude of p[first, last); NaN if any element is NaN.
+     */
+    template< typename T >
+    double max_magnitude( T const * const p, std::size_t const first, std::size_t const last )
+    {
+        // four lanes, without branches; a NaN is noted aside:
+        double m[4] = { 0, 0, 0, 0 };
+        bool nan = false;
+
+        std::size_t i = first;
+        for ( ; i + 4 <= last; i += 4 )
+        {
+            for ( unsigned lane = 0; lane < 4; ++lane )
+            {
+                double const a = std::fabs( double( p[ i + lane ] ) );
+                m[lane] = a > m[lane] ? a : m[lane];
+                nan |= a != a;
+            }
+        }
+        for ( ; i < last; ++i )
+        {
+            double const a = std::fabs( double( p[i] ) );
+            m[0] = a > m[0] ? a : m[0];
+            nan |= a != a;
+        }
+
+        if ( nan )
+            return std::numeric_limits<double>::quiet_NaN();
+
+        double const m01 = m[0] > m[1] ? m[0] : m[1];
+        double const m23 = m[2] > m[3] ? m[2] : m[3];
+        return m01 > m23 ? m01 : m23;
+    }
+
+    /**
+     * level totals of p[first, last) split along the boundaries in m.
+     */
+    template< typename T >
+    void level_sums( T const * const p, std::size_t const first, std::size_t const last,
+                     double const * const m, double * const total )
+    {
+        // four lanes per level; the sums are exact, so the lanes may be added in any order:
+        double s[ sum_levels ][4] = {};
+
+        std::size_t i = first;
+        for ( ; i + 4 <= last; i += 4 )
+        {
+            double r[4];
+            for ( unsigned lane = 0; lane < 4; ++lane )
+                r[lane] = double( p[ i + lane ] );
+
+            for ( int k = 0; k < sum_levels; ++k )
+            {
+                for ( unsigned lane = 0; lane < 4; ++lane )
+                {
+                    double const q = ( m[k] + r[lane] ) - m[k];
+                    s[k][lane] += q;
+                    r[lane] -= q;
+                }
+            }
+        }
+        for ( ; i < last; ++i )
+        {
+            double r = double( p[i] );
+            for ( int k = 0; k < sum_levels; ++k )
+            {
+                double const q = ( m[k] + r ) - m[k];
+                s[k][0] += q;
+                r -= q;
+            }
+        }
+
+        for ( int k = 0; k < sum_levels; ++k )
+            total[k] = ( s[k][0] + s[k][1] ) + ( s[k][2] + s[k][3] );
+    }
+
+    template< typename T >
+    double reproducible_sum( T const * const p, std::size_t const n, unsigned threads )
+    {
+        if ( n == 0 )
+            return 0;
+
+        threads = parallel_threads( threads, n );
+
+        // largest magnitude, exact in any order:
+
+        std::vector<double> part( threads, 0.0 );
+
+        parallel_for( 0, n, threads, [&]( std::size_t first, std::size_t last, unsigned t )
+        {
+            part[t] = max_magnitude( p, first, last );
+        }, parallel_grain );
+
+        double amax = 0;
+        for ( unsigned t = 0; t < threads; ++t )
+            amax = part[t] > amax || part[t] != part[t] ? part[t] : amax;
+
+        if ( amax == 0 )
+            return 0;
+
+        if ( !( amax <= std::numeric_limits<double>::max() ) )
+        {
+            // infinity or NaN:
+            double s = 0;
+            for ( std::size_t i = 0; i < n; ++i )
+                s += double( p[i] );
+            return s;
+        }
+
+        // boundaries: the sum of n parts of a level stays below 2^(e + L) with
+        // the parts multiples of its unit 2^(e + L - 52), so it is exact.
+
+        int e = 0;
+        std::frexp( amax, &e );                 // amax < 2^e
+
+        int L = 1;
+        while ( L < 62 && ( std::size_t( 1 ) << L ) <= n )
+            ++L;                                // n < 2^L
+
+        // scale down values that would push the first boundary out of range:
+        int const over = e + L + 2 - std::numeric_limits<double>::max_exponent;
+
+        double m[ sum_levels ];
+        for ( int k = 0; k < sum_levels; ++k )
+        {
+            // a boundary larger than needed only costs accuracy, never exactness:
+            int const ek = e + L - k * ( std::numeric_limits<double>::digits - L ) - ( over > 0 ? over : 0 );
+            m[k] = std::ldexp( 1.5, ek > std::numeric_limits<double>::min_exponent ? ek : std::numeric_limits<double>::min_exponent );
+        }
+
+        std::vector<double> totals( threads * sum_levels, 0.0 );
+
+        parallel_for( 0, n, threads, [&]( std::size_t first, std::size_t last, unsigned t )
+        {
+            if ( over > 0 )
+            {
+                std::vector<double> scaled( last - first );
+                for ( std::size_t i = first; i < last; ++i )
+                    scaled[ i - first ] = std::ldexp( double( p[i] ), -over );
+                level_sums( scaled.data(), 0, scaled.size(), m, &totals[ sum_levels * t ] );
+            }
+            else
+            {
+                level_sums( p, first, last, m, &totals[ sum_levels * t ] );
+            }
+        }, parallel_grain );
+
+        // level totals are exact; add them, largest level first:
+
+        double s = 0;
+        for ( int k = 0; k < sum_levels; ++k )
+        {
+            double level = 0;
+            for ( unsigned t = 0; t < threads; ++t )
+                level += totals[ sum_levels * t + k ];
+            s += level;
+        }
+
+        return over > 0 ? std::ldexp( s, over ) : s;
+    }
+
+    template< typename T >
+    double compensated_sum( T const * const p, std::size_t const n, unsigned threads )
+    {
+        threads = parallel_threads( threads, n );
+
+        std::vector<double> sum( threads, 0.0 ), comp( threads, 0.0 );
+
+        parallel_for( 0, n, threads, [&]( std::size_t first, std::size_t last, unsigned t )
+        {
+            double s = 0, c = 0;
+            for ( std::size_t i = first; i < last; ++i )
+                neumaier_add( s, c, double( p[i] ) );
+            sum[t] = s;
+            comp[t] = c;
+        }, parallel_grain );
+
+        double s = 0, c = 0;
+        for ( unsigned t = 0; t < threads; ++t )
+        {
+            neumaier_add( s, c, sum[t] );
+            c += comp[t];
+        }
+        return s + c;
+    }
+
+} // namespace detail
+
+/**
+ * sum of a, bit-identical for any number of threads; threads 0 means all
+ * hardware threads.
+ */
+template< typename Q >
+typename std::remove_const<Q>::type reproducible_sum( span<Q> const a, unsigned const threads = 1 )
+{
+    typedef typename std::remove_const<Q>::type V;
+    typedef typename V::value_type T;
+
+    static_assert( std::is_floating_point<T>::value, "reproducible_sum: underlying type must be floating point" );
+
+    return V( T( detail::reproducible_sum( values( span<V const>( a ) ).data(), a.size(), threads ) ) );
+}
+
+/**
+ * sum of a with Neumaier compensation.
+ */
+template< typename Q >
+typename std::remove_const<Q>::type compensated_sum( span<Q> const a, unsigned const threads = 1 )
+{
+    typedef typename std::remove_const<Q>::type V;
+    typedef typename V::value_type T;
+
+    static_assert( std::is_floating_point<T>::value, "compensated_sum: underlying type must be floating point" );
+
+    return V( T( detail::compensated_sum( values( span<V const>( a ) ).data(), a.size(), threads ) ) );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_SUM_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,256 @@
+/*
+ * whole_value_tsc.h
+ * timestamps from the time stamp counter, calibrated to nanoseconds.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * tsc_clock reads the x86 time stamp counter: now() is a single rdtsc, and
+ * now_ordered() an rdtscp, which waits for the preceding instructions to
+ * complete. A read costs a few nanoseconds, where steady_clock::now() goes
+ * through the vDSO and takes several times as long.
+ *
+ * The stamps are tsc_clock::stamp, a point of tsc_clock::ticks, a
+ * quantity<uint64_t>; stamp - stamp gives elapsed ticks. calibrate() measures
+ * the tick rate against steady_clock over a short window, after which
+ * to_nanoseconds() and to_time() convert ticks and stamps with a 32.32
+ * fixed-point scale: a 64 by 64-bit multiply and a shift, no divide and no
+ * floating point. to_time() gives a tsc_clock::time_point, a point of
+ * nanoseconds on the steady_clock time line, which whole_value_chrono.h
+ * converts to a steady_clock::time_point.
+ *
+ * Where the counter is missing or does not run at a constant rate across
+ * cores and power states (no invariant TSC, as on many virtual machines),
+ * and on other architectures, calibrate() returns the fallback clock: now()
+ * reads clock_gettime( CLOCK_MONOTONIC ) (steady_clock outside Linux), and
+ * a tick is a nanosecond. The same code works on both; uses_tsc() tells
+ * which one runs.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_TSC_H_INCLUDED
+#define G_WV_WHOLE_VALUE_TSC_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_affine.h"
+#include "whole_value_fixed.h"
+
+#include <chrono>
+#include <ratio>
+#include <stdint.h>
+
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+# define G_WV_HAVE_RDTSC
+# ifdef _MSC_VER
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+#  include <x86intrin.h>
+# endif
+#endif
+
+#ifdef __linux__
+# include <time.h>
+#endif
+
+namespace wv {
+
+namespace detail {
+
+    struct tsc_ticks_tag {};
+    struct tsc_stamp_tag {};
+    struct tsc_nanoseconds_tag { typedef std::nano period; };
+    struct tsc_time_tag { typedef std::chrono::steady_clock clock; };
+
+    /**
+     * nanoseconds on the steady_clock time line.
+     */
+    inline int64_t steady_nanoseconds()
+    {
+#ifdef __linux__
+        timespec t;
+        clock_gettime( CLOCK_MONOTONIC, &t );
+        return int64_t( t.tv_sec ) * 1000000000 + t.tv_nsec;
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+    }
+
+    /**
+     * x * scale / 2^32 for a 32.32 fixed-point scale.
+     */
+    inline uint64_t tsc_scale( uint64_t const x, uint64_t const scale )
+    {
+        return ( mulhi( x, scale ) << 32 ) | ( ( x * scale ) >> 32 );
+    }
+
+} // namespace detail
+
+/**
+ * clock that reads the time stamp counter, or clock_gettime() where that is
+ * not usable.
+ */
+class tsc_clock
+{
+public:
+    typedef quantity<uint64_t, detail::tsc_ticks_tag> ticks;
+    typedef point<ticks, detail::tsc_stamp_tag> stamp;
+    typedef quantity<int64_t, detail::tsc_nanoseconds_tag> nanoseconds;
+    typedef point<nanoseconds, detail::tsc_time_tag> time_point;
+
+    /**
+     * the fallback clock: stamps are steady nanoseconds.
+     */
+    tsc_clock()
+    : m_tsc( false )
+    , m_scale( uint64_t( 1 ) << 32 )
+    , m_stamp( 0 )
+    , m_time( 0 ) {}
+
+    /**
+     * the counter clock that read s0 at t0 and s1 at t1.
+     */
+    tsc_clock( stamp const s0, time_point const t0, stamp const s1, time_point const t1 )
+    : m_tsc( true )
+    , m_scale( uint64_t( double( ( t1 - t0 ).value() ) / double( ( s1 - s0 ).value() ) * 4294967296.0 + 0.5 ) )
+    , m_stamp( s1 )
+    , m_time( t1 ) {}
+
+    /**
+     * whether the processor has a time stamp counter with a constant rate.
+     */
+    static bool invariant()
+    {
+#if defined( G_WV_HAVE_RDTSC ) && defined( _MSC_VER )
+        int r[4];
+        __cpuid( r, 0x80000000 );
+        if ( unsigned( r[0] ) < 0x80000007u )
+            return false;
+        __cpuid( r, 0x80000007 );
+        return ( r[3] & ( 1 << 8 ) ) != 0;
+#elif defined( G_WV_HAVE_RDTSC )
+        unsigned a, b, c, d;
+        return __get_cpuid( 0x80000007u, &a, &b, &c, &d ) && ( d & ( 1u << 8 ) ) != 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * the counter clock with its rate measured over window, or the fallback
+     * clock where the counter is not invariant.
+     */
+    static tsc_clock calibrate( std::chrono::nanoseconds const window = std::chrono::milliseconds( 10 ) )
+    {
+#ifdef G_WV_HAVE_RDTSC
+        if ( invariant() )
+        {
+            stamp s0, s1;
+            time_point const t0 = sample( s0 );
+            while ( detail::steady_nanoseconds() - t0.value() < window.count() ) {}
+            time_point const t1 = sample( s1 );
+            return tsc_clock( s0, t0, s1, t1 );
+        }
+#else
+        (void) window;
+#endif
+        return tsc_clock();
+    }
+
+    bool uses_tsc() const { return m_tsc; }
+
+    /**
+     * nanoseconds per tick in 32.32 fixed point.
+     */
+    uint64_t scale() const { return m_scale; }
+
+    /**
+     * the current stamp.
+     */
+    stamp now() const
+    {
+#ifdef G_WV_HAVE_RDTSC
+        if ( m_tsc )
+            return stamp( __rdtsc() );
+#endif
+        return stamp( uint64_t( detail::steady_nanoseconds() ) );
+    }
+
+    /**
+     * the current stamp, read after the preceding instructions complete.
+     */
+    stamp now_ordered() const
+    {
+#ifdef G_WV_HAVE_RDTSC
+        if ( m_tsc )
+        {
+            unsigned aux;
+            return stamp( __rdtscp( &aux ) );
+        }
+#endif
+        return stamp( uint64_t( detail::steady_nanoseconds() ) );
+    }
+
+    /**
+     * elapsed ticks in nanoseconds.
+     */
+    nanoseconds to_nanoseconds( ticks const t ) const
+    {
+        return nanoseconds( int64_t( detail::tsc_scale( t.value(), m_scale ) ) );
+    }
+
+    /**
+     * stamp on the steady_clock time line.
+     */
+    time_point to_time( stamp const s ) const
+    {
+        return s >= m_stamp ?
+            m_time + to_nanoseconds( s - m_stamp ) :
+            m_time - to_nanoseconds( m_stamp - s );
+    }
+
+private:
+#ifdef G_WV_HAVE_RDTSC
+    /**
+     * steady time, and in s the stamp halfway the shortest of a few reads of it.
+     */
+    static time_point sample( stamp & s )
+    {
+        uint64_t best = ~uint64_t( 0 );
+        int64_t time = 0;
+        for ( int i = 0; i < 5; ++i )
+        {
+            unsigned aux;
+            uint64_t const before = __rdtscp( &aux );
+            int64_t const t = detail::steady_nanoseconds();
+            uint64_t const after = __rdtscp( &aux );
+            if ( after - before < best )
+            {
+                best = after - before;
+                time = t;
+                s = stamp( before + ( after - before ) / 2 );
+            }
+        }
+        return time_point( time );
+    }
+#endif
+
+    bool m_tsc;
+    uint64_t m_scale;
+    stamp m_stamp;
+    time_point m_time;
+};
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_TSC_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,241 @@
+/*
+ * whole_value_unit.h
+ * quantities in related units: compile-time scale between them.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Requires C++11.
+ *
+ * scaled<T, Family, Ratio> is a quantity of T in units of Ratio (a
+ * std::ratio) of the family's base unit: with Family any type that names
+ * what is measured, such as a tag struct or a dimension<...> from
+ * whole_value_dimension.h, milliseconds and seconds are
+ *
+ *   scaled<int64_t, Time, std::milli> and scaled<int64_t, Time, std::ratio<1>>.
+ *
+ * A scaled quantity converts implicitly to another of the same family when
+ * no information is lost, following std::chrono::duration: to a floating
+ * point T from any scale, and to an integral T when the factor is an
+ * integer (seconds to milliseconds, KiB to bytes). unit_cast<>() converts
+ * in any direction and truncates toward zero, like duration_cast. The
+ * factor is a compile-time constant: an integral conversion is a multiply
+ * or a divide by a constant, and a floating point one a multiply by the
+ * factor rounded once.
+ *
+ * + - and comparisons of quantities of one family in different units or
+ * underlying types use the common type and the coarsest unit that
+ * represents both exactly, as chrono does; other operations are those of
+ * quantity.
+ *
+ * convert() converts a span of scaled quantities to another unit, one
+ * multiply (or divide) per element in a loop that the compiler vectorizes
+ * (GCC and Clang at -O3).
+ *
+ * Use WV_DEFINE_SCALED_TYPE() to create the types.
+ */
+
+#ifndef G_WV_WHOLE_VALUE_UNIT_H_INCLUDED
+#define G_WV_WHOLE_VALUE_UNIT_H_INCLUDED
+
+#include "whole_value.h"
+#include "whole_value_span.h"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <ratio>
+#include <stdint.h>
+#include <type_traits>
+
+/**
+ * create quantity type in units of ratio of the family's base unit.
+ */
+#define WV_DEFINE_SCALED_TYPE( type_name, underlying_type, family, ratio ) \
+    typedef ::wv::scaled<underlying_type, family, ratio::type> type_name;
+
+namespace wv {
+
+/**
+ * tag of the quantity of a family in units of Ratio.
+ */
+template< typename Family, typename Ratio >
+struct unit
+{
+    typedef Ratio period;
+};
+
+template< typename T, typename Family, typename Ratio >
+class scaled;
+
+namespace detail {
+
+    /**
+     * x of U in units of R, as T in units of RT.
+     */
+    template< typename U, typename R, typename T, typename RT >
+    struct unit_convert
+    {
+        typedef std::ratio_divide<R, RT> factor;
+        typedef typename std::common_type<T, U, intmax_t>::type C;
+
+        static const bool floating = std::is_floating_point<C>::value;
+
+        static constexpr T apply( U const x )
+        {
+            return T(
+                factor::num == 1 && factor::den == 1 ? C( x ) :
+                floating ? C( x ) * ( C( factor::num ) / C( factor::den ) ) :
+                factor::den == 1 ? C( x ) * C( factor::num ) :
+                factor::num == 1 ? C( x ) / C( factor::den ) :
+                C( x ) * C( factor::num ) / C( factor::den ) );
+        }
+
+        /**
+         * the conversion loses nothing but range.
+         */
+        static const bool lossless = std::is_floating_point<T>::value ||
+            ( factor::den == 1 && std::is_integral<U>::value && std::numeric_limits<U>::digits <= std::numeric_limits<T>::digits );
+    };
+
+    /**
+     * greatest common divisor of A and B.
+     */
+    template< intmax_t A, intmax_t B >
+    struct unit_gcd : unit_gcd< B, A % B > {};
+
+    template< intmax_t A >
+    struct unit_gcd< A, 0 >
+    {
+        static const intmax_t value = A < 0 ? -A : A;
+    };
+
+    /**
+     * the coarsest unit in which units R1 and R2 are whole.
+     */
+    template< typename R1, typename R2 >
+    struct unit_common
+    {
+        typedef std::ratio<
+            unit_gcd< R1::num, R2::num >::value,
+            R1::den / unit_gcd< R1::den, R2::den >::value * R2::den > type;
+    };
+
+} // namespace detail
+
+/**
+ * quantity of T in units of Ratio of the base unit of Family.
+ */
+template< typename T, typename Family, typename Ratio >
+class scaled : public quantity< T, unit<Family, Ratio> >
+{
+    typedef quantity< T, unit<Family, Ratio> > base;
+
+public:
+    typedef T value_type;
+    typedef Family family;
+    typedef Ratio ratio;
+
+    constexpr scaled() : base() {}
+
+    constexpr explicit scaled( value_type const value ) : base( value ) {}
+
+    /**
+     * from the results of quantity operations.
+     */
+    constexpr scaled( base const & other ) : base( other ) {}
+
+    /**
+     * from the same family in another unit, where nothing is lost.
+     */
+    template< typename U, typename R, typename = typename std::enable_if< detail::unit_convert<U, R, T, Ratio>::lossless >::type >
+    constexpr scaled( scaled<U, Family, R> const & other ) : base( detail::unit_convert<U, R, T, Ratio>::apply( other.value() ) ) {}
+};
+
+/**
+ * x in the units of To, truncated toward zero.
+ */
+template< typename To, typename U, typename Family, typename R >
+inline To unit_cast( scaled<U, Family, R> const & x )
+{
+    static_assert( std::is_same< typename To::family, Family >::value, "unit_cast: different families" );
+
+    return To( detail::unit_convert<U, R, typename To::value_type, typename To::ratio>::apply( x.value() ) );
+}
+
+/**
+ * common value type and unit of two quantities of a family.
+ */
+template< typename T1, typename T2, typename Family, typename R1, typename R2 >
+using scaled_common = scaled< typename std::common_type<T1, T2>::type, Family, typename detail::unit_common<R1, R2>::type >;
+
+/**
+ * x + y and x - y in the common unit.
+ */
+template< typename T1, typename T2, typename Family, typename R1, typename R2 >
+inline scaled_common<T1, T2, Family, R1, R2> operator+( scaled<T1, Family, R1> const & x, scaled<T2, Family, R2> const & y )
+{
+    typedef scaled_common<T1, T2, Family, R1, R2> C;
+    return C( C( x ).value() + C( y ).value() );
+}
+
+template< typename T1, typename T2, typename Family, typename R1, typename R2 >
+inline scaled_common<T1, T2, Family, R1, R2> operator-( scaled<T1, Family, R1> const & x, scaled<T2, Family, R2> const & y )
+{
+    typedef scaled_common<T1, T2, Family, R1, R2> C;
+    return C( C( x ).value() - C( y ).value() );
+}
+
+/**
+ * comparisons in the common unit.
+ */
+#define G_WV_UNIT_COMPARISON( op ) \
+    template< typename T1, typename T2, typename Family, typename R1, typename R2 > \
+    inline bool operator op( scaled<T1, Family, R1> const & x, scaled<T2, Family, R2> const & y ) \
+    { \
+        typedef scaled_common<T1, T2, Family, R1, R2> C; \
+        return C( x ).value() op C( y ).value(); \
+    }
+
+G_WV_UNIT_COMPARISON( == )
+G_WV_UNIT_COMPARISON( != )
+G_WV_UNIT_COMPARISON( <  )
+G_WV_UNIT_COMPARISON( <= )
+G_WV_UNIT_COMPARISON( >  )
+G_WV_UNIT_COMPARISON( >= )
+
+#undef G_WV_UNIT_COMPARISON
+
+/**
+ * out[i] = unit_cast<Q2>( in[i] ).
+ */
+template< typename Q1, typename Q2 >
+void convert( span<Q1> const in, span<Q2> const out )
+{
+    typedef typename std::remove_const<Q1>::type V;
+    typedef typename V::value_type U;
+    typedef typename Q2::value_type T;
+    typedef detail::unit_convert< U, typename V::ratio, T, typename Q2::ratio > convert_type;
+
+    static_assert( std::is_same< typename V::family, typename Q2::family >::value, "convert: different families" );
+    assert( in.size() == out.size() && "convert: different sizes" );
+
+    U const * const a = values( span<V const>( in ) ).data();
+    T * const r = values( out ).data();
+
+    for ( std::size_t i = 0; i < in.size(); ++i )
+        r[i] = convert_type::apply( a[i] );
+}
+
+} // namespace wv
+
+#endif // G_WV_WHOLE_VALUE_UNIT_H_INCLUDED
+
+/*
+ * end of file
+ */
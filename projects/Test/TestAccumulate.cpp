@@ -0,0 +1,117 @@
+/*
+ * TestAccumulate.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_accumulate.h"
+
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Volume, int32_t )
+WV_DEFINE_QUANTITY_TYPE( Ticks, uint16_t )
+WV_DEFINE_ARITHMETIC_TYPE( Weight, float )
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Shares, Volume )
+
+/* ----------------------------------------------------------------------------
+ * accumulator:
+ */
+
+TEST_CASE( "accumulate/types",
+           "Accumulator types keep template and tag and widen the underlying type." )
+{
+    REQUIRE(( std::is_same< wv::accumulator<Volume>::type, wv::quantity<int64_t, Volume_tag> >::value ));
+    REQUIRE(( std::is_same< wv::accumulator<Ticks>::type, wv::quantity<uint64_t, Ticks_tag> >::value ));
+    REQUIRE(( std::is_same< wv::accumulator<Weight>::type, wv::arithmetic<double, Weight_tag> >::value ));
+    REQUIRE(( std::is_same< wv::accumulator<Price>::type, Price >::value ));
+    REQUIRE(( std::is_same< wv::accumulator<Shares>::type, wv::quantity<int64_t, Volume_tag> >::value ));
+
+    REQUIRE(( std::is_same< wv::accumulator<Volume>::mean_type, wv::quantity<double, Volume_tag> >::value ));
+    REQUIRE(( std::is_same< wv::accumulator<Weight>::mean_type, wv::arithmetic<double, Weight_tag> >::value ));
+}
+
+/* ----------------------------------------------------------------------------
+ * sum, mean:
+ */
+
+TEST_CASE( "accumulate/sum-int32",
+           "A sum of int32_t quantities that overflows int32_t is exact." )
+{
+    std::vector<Volume> v( 1003, Volume( 2000000000 ) );
+    v[5] = Volume( -7 );
+
+    wv::accumulator<Volume>::type const s = wv::sum( wv::make_span( v ) );
+
+    REQUIRE( s.value() == 1002 * int64_t( 2000000000 ) - 7 );
+    REQUIRE( wv::mean( wv::make_span( v ) ).value() == Approx( s.value() / 1003.0 ) );
+}
+
+TEST_CASE( "accumulate/sum-float",
+           "A sum of floats is accumulated in double." )
+{
+    std::vector<Weight> v( 10000001, Weight( 0.1f ) );
+
+    double const expected = 10000001 * double( 0.1f );
+
+    REQUIRE( wv::sum( wv::make_span( v ) ).value() == Approx( expected ).epsilon( 1e-12 ) );
+    REQUIRE( wv::mean( wv::make_span( v ) ).value() == Approx( double( 0.1f ) ).epsilon( 1e-12 ) );
+}
+
+TEST_CASE( "accumulate/sum-misc",
+           "Empty spans, unsigned and sub types." )
+{
+    REQUIRE( wv::sum( wv::span<Volume const>() ).value() == 0 );
+    REQUIRE( wv::mean( wv::span<Volume const>() ).value() == 0.0 );
+
+    std::vector<Ticks> t( 70000, Ticks( 65535 ) );
+    REQUIRE( wv::sum( wv::make_span( t ) ).value() == 70000 * uint64_t( 65535 ) );
+
+    std::vector<Shares> s( 3, Shares( 5 ) );
+    REQUIRE( wv::sum( wv::make_span( s ) ).value() == 15 );
+}
+
+/* ----------------------------------------------------------------------------
+ * widen, narrow:
+ */
+
+TEST_CASE( "accumulate/widen-narrow",
+           "Widen to the accumulator type, compute, and narrow back." )
+{
+    std::vector<Volume> v;
+    for ( int i = -10; i < 10; ++i )
+        v.push_back( Volume( i * 100000000 ) );
+
+    std::vector< wv::accumulator<Volume>::type > w( v.size() );
+    wv::widen( wv::make_span( v ), wv::make_span( w ) );
+
+    for ( std::size_t i = 0; i < v.size(); ++i )
+    {
+        REQUIRE( w[i].value() == v[i].value() );
+        w[i] = w[i] / 2;
+    }
+
+    std::vector<Volume> back( v.size() );
+    wv::narrow( wv::make_span( w ), wv::make_span( back ) );
+
+    for ( std::size_t i = 0; i < v.size(); ++i )
+        REQUIRE( back[i].value() == v[i].value() / 2 );
+}
+
+/*
+ * end of file
+ */
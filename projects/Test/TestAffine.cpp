@@ -0,0 +1,96 @@
+/*
+ * TestAffine.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_affine.h"
+
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Duration, int64_t )
+WV_DEFINE_POINT_TYPE( Timestamp, Duration )
+
+WV_DEFINE_QUANTITY_TYPE( Offset, int32_t )
+WV_DEFINE_POINT_TYPE( Position, Offset )
+
+namespace {
+
+template< typename A, typename B, typename = void >
+struct can_add : std::false_type {};
+
+template< typename A, typename B >
+struct can_add< A, B, decltype( void( std::declval<A>() + std::declval<B>() ) ) > : std::true_type {};
+
+template< typename A, typename B, typename = void >
+struct can_multiply : std::false_type {};
+
+template< typename A, typename B >
+struct can_multiply< A, B, decltype( void( std::declval<A>() * std::declval<B>() ) ) > : std::true_type {};
+}
+
+TEST_CASE( "affine/types",
+           "Only the affine operations compile." )
+{
+    REQUIRE( ( std::is_same< decltype( Timestamp() - Timestamp() ), Duration >::value ) );
+    REQUIRE( ( std::is_same< decltype( Timestamp() + Duration() ), Timestamp >::value ) );
+    REQUIRE( ( std::is_same< decltype( Duration() + Timestamp() ), Timestamp >::value ) );
+    REQUIRE( ( std::is_same< decltype( Timestamp() - Duration() ), Timestamp >::value ) );
+
+    REQUIRE( !( can_add< Timestamp, Timestamp >::value ) );
+    REQUIRE( !( can_add< Timestamp, int64_t >::value ) );
+    REQUIRE( !( can_add< Timestamp, Offset >::value ) );
+    REQUIRE( !( can_add< Timestamp, Position >::value ) );
+    REQUIRE( !( can_multiply< Timestamp, int64_t >::value ) );
+    REQUIRE( ( can_add< Duration, Duration >::value ) );
+
+    REQUIRE( sizeof( Timestamp ) == sizeof( int64_t ) );
+    REQUIRE( std::is_trivially_copyable<Timestamp>::value );
+}
+
+TEST_CASE( "affine/values",
+           "Points and vectors compute like the underlying type." )
+{
+    Timestamp const t0( 1000 );
+    Timestamp const t1( 1250 );
+
+    REQUIRE( t1 - t0 == Duration( 250 ) );
+    REQUIRE( t0 - t1 == Duration( -250 ) );
+    REQUIRE( t0 + Duration( 250 ) == t1 );
+    REQUIRE( Duration( 250 ) + t0 == t1 );
+    REQUIRE( t1 - Duration( 250 ) == t0 );
+    REQUIRE( t0 < t1 );
+    REQUIRE( t1 >= t0 );
+    REQUIRE( t0 != t1 );
+
+    Timestamp t = t0;
+    t += Duration( 50 );
+    t -= Duration( 20 );
+    REQUIRE( t.value() == 1030 );
+
+    REQUIRE( Timestamp::from_origin( Duration( 7 ) ).value() == 7 );
+    REQUIRE( t1.since_origin() == Duration( 1250 ) );
+    REQUIRE( to_value( t1 ) == 1250 );
+    REQUIRE( to_real( t1 ) == 1250.0 );
+
+    Position const p( 10 );
+    REQUIRE( ( p + Offset( 5 ) - p ).value() == 5 );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,153 @@
+/*
+ * TestBounded.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_bounded.h"
+
+#include <stdexcept>
+#include <stdint.h>
+#include <type_traits>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Points, int32_t )
+WV_DEFINE_ARITHMETIC_TYPE( Number, int64_t )
+WV_DEFINE_QUANTITY_TYPE( PortNumber, uint32_t )
+
+WV_DEFINE_BOUNDED_TYPE( Percent, Points, 0, 100 )
+WV_DEFINE_BOUNDED_TYPE( Port, PortNumber, 0, 65535 )
+WV_DEFINE_BOUNDED_TYPE( Digit, Number, 0, 9 )
+
+typedef wv::bounded<Points, -1000, 1000> Delta;
+typedef wv::bounded<Points, 0, 100, wv::sticky_overflow> StickyPercent;
+
+template< typename X, typename Y, typename = void >
+struct can_multiply : std::false_type {};
+
+template< typename X, typename Y >
+struct can_multiply< X, Y, decltype( void( std::declval<X>() * std::declval<Y>() ) ) > : std::true_type {};
+
+template< typename X, typename Y, typename = void >
+struct can_divide : std::false_type {};
+
+template< typename X, typename Y >
+struct can_divide< X, Y, decltype( void( std::declval<X>() / std::declval<Y>() ) ) > : std::true_type {};
+
+TEST_CASE( "bounded/storage",
+           "A bounded value is stored in the smallest type that holds its range." )
+{
+    REQUIRE( sizeof( Percent ) == 1 );
+    REQUIRE( sizeof( Port ) == 2 );
+    REQUIRE( sizeof( Delta ) == 2 );
+    REQUIRE( ( std::is_same< Percent::storage_type, uint8_t >::value ) );
+    REQUIRE( ( std::is_same< Delta::storage_type, int16_t >::value ) );
+    REQUIRE( ( std::is_same< wv::bounded<Points, -128, 127>::storage_type, int8_t >::value ) );
+    REQUIRE( ( std::is_same< wv::bounded<Points, -129, 0>::storage_type, int16_t >::value ) );
+    REQUIRE( ( std::is_same< wv::bounded<Number, 0, 70000>::storage_type, uint32_t >::value ) );
+    REQUIRE( ( std::is_same< wv::bounded<Number, 0, 5000000000ll>::storage_type, uint64_t >::value ) );
+    REQUIRE( ( std::is_same< wv::bounded<Number, -1, 5000000000ll>::storage_type, int64_t >::value ) );
+}
+
+TEST_CASE( "bounded/construct",
+           "Construction checks the range once." )
+{
+    REQUIRE( Percent().value() == Points( 0 ) );
+    REQUIRE( ( wv::bounded<Points, 5, 10>().value() == Points( 5 ) ) );
+    REQUIRE( ( wv::bounded<Points, -10, -5>().value() == Points( -5 ) ) );
+
+    REQUIRE( Percent( Points( 42 ) ).value() == Points( 42 ) );
+    REQUIRE( Percent( Points( 100 ) ).raw() == 100 );
+    REQUIRE_THROWS_AS( Percent( Points( 101 ) ), std::overflow_error );
+    REQUIRE_THROWS_AS( Percent( Points( -1 ) ), std::overflow_error );
+    REQUIRE( Port( PortNumber( 65535 ) ).raw() == 65535u );
+    REQUIRE_THROWS_AS( Port( PortNumber( 65536 ) ), std::overflow_error );
+
+    REQUIRE( Percent::contains( Points( 100 ) ) );
+    REQUIRE( !Percent::contains( Points( 101 ) ) );
+
+    // a returning policy clamps:
+    wv::sticky_overflow::test_and_clear();
+    REQUIRE( StickyPercent( Points( 250 ) ).raw() == 100 );
+    REQUIRE( wv::sticky_overflow::test_and_clear() );
+    REQUIRE( StickyPercent( Points( -3 ) ).raw() == 0 );
+    REQUIRE( wv::sticky_overflow::test_and_clear() );
+    REQUIRE( StickyPercent( Points( 3 ) ).raw() == 3 );
+    REQUIRE( !wv::sticky_overflow::test_and_clear() );
+}
+
+TEST_CASE( "bounded/operators",
+           "Results carry the bounds derived from the operands." )
+{
+    Percent const a( Points( 60 ) ), b( Points( 70 ) );
+
+    REQUIRE( ( std::is_same< decltype( a + b ), wv::bounded<Points, 0, 200> >::value ) );
+    REQUIRE( ( std::is_same< decltype( a - b ), wv::bounded<Points, -100, 100> >::value ) );
+    REQUIRE( ( std::is_same< decltype( -a ), wv::bounded<Points, -100, 0> >::value ) );
+    REQUIRE( ( std::is_same< decltype( a + b + b ), wv::bounded<Points, 0, 300> >::value ) );
+
+    REQUIRE( ( a + b ).value() == Points( 130 ) );
+    REQUIRE( ( a - b ).value() == Points( -10 ) );
+    REQUIRE( ( -a ).value() == Points( -60 ) );
+
+    // quantity * quantity is not a quantity:
+    REQUIRE( !( can_multiply< Percent, Percent >::value ) );
+
+    Digit const d( Number( 7 ) );
+    wv::bounded<Number, -3, 4> const e( Number( -3 ) );
+    wv::bounded<Number, 2, 4> const f( Number( 3 ) );
+
+    REQUIRE( ( std::is_same< decltype( d * e ), wv::bounded<Number, -27, 36> >::value ) );
+    REQUIRE( ( d * e ).value() == Number( -21 ) );
+    REQUIRE( ( std::is_same< decltype( d / f ), wv::bounded<Number, 0, 4> >::value ) );
+    REQUIRE( ( d / f ).value() == Number( 2 ) );
+    REQUIRE( ( std::is_same< decltype( e / f ), wv::bounded<Number, -1, 2> >::value ) );
+    REQUIRE( ( e / f ).value() == Number( -1 ) );
+
+    // the divisor range may not include zero:
+    REQUIRE( ( can_divide< Digit, decltype( f ) >::value ) );
+    REQUIRE( !( can_divide< Digit, Digit >::value ) );
+
+    REQUIRE( a < b );
+    REQUIRE( a + b > b );
+    REQUIRE( a - b != Delta( Points( 10 ) ) );
+    REQUIRE( a == wv::bounded<Points, 0, 255>( Points( 60 ) ) );
+}
+
+TEST_CASE( "bounded/conversion",
+           "Widening converts implicitly, narrowing with bounded_cast." )
+{
+    REQUIRE( ( std::is_convertible< Percent, Delta >::value ) );
+    REQUIRE( ( std::is_convertible< Percent, wv::bounded<Points, 0, 200> >::value ) );
+    REQUIRE( !( std::is_convertible< Delta, Percent >::value ) );
+    REQUIRE( !( std::is_convertible< Points, Percent >::value ) );
+
+    Percent const a( Points( 60 ) ), b( Points( 70 ) );
+
+    Delta const d = a;
+    REQUIRE( d.value() == Points( 60 ) );
+
+    wv::bounded<Points, 0, 200> const s = a + b;
+    REQUIRE( wv::bounded_cast<Percent>( s - a ) == b );
+    REQUIRE_THROWS_AS( wv::bounded_cast<Percent>( a + b ), std::overflow_error );
+    REQUIRE_THROWS_AS( wv::bounded_cast<Percent>( a - b ), std::overflow_error );
+
+    REQUIRE( wv::to_value( a ) == 60 );
+    REQUIRE( wv::to_integer( a ) == 60 );
+    REQUIRE( wv::to_real( a ) == 60.0 );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,151 @@
+/*
+ * TestChecked.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_checked.h"
+
+#include <limits>
+#include <stdint.h>
+#include <string>
+
+// Define fundamental value types:
+WV_DEFINE_CHECKED_ARITHMETIC_TYPE( Count, int32_t, ::wv::throw_on_overflow )
+WV_DEFINE_CHECKED_ARITHMETIC_TYPE( Small, int8_t, ::wv::sticky_overflow )
+WV_DEFINE_CHECKED_ARITHMETIC_TYPE( Index, uint16_t, ::wv::throw_on_overflow )
+WV_DEFINE_CHECKED_QUANTITY_TYPE( Volume, int64_t, ::wv::throw_on_overflow )
+WV_DEFINE_CHECKED_QUANTITY_TYPE( Ticks, int32_t, ::wv::callback_on_overflow )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Shares, Volume )
+
+namespace {
+
+int32_t const int_max = std::numeric_limits<int32_t>::max();
+int32_t const int_min = std::numeric_limits<int32_t>::min();
+
+std::string last_overflow;
+
+void record_overflow( char const * const what )
+{
+    last_overflow = what;
+}
+}
+
+/* ----------------------------------------------------------------------------
+ * checked_arithmetic:
+ */
+
+TEST_CASE( "checked/arithmetic-ok",
+           "Operations that fit behave like arithmetic." )
+{
+    Count a( 7 ), b( 3 );
+
+    REQUIRE( ( a + b ).value() == 10 );
+    REQUIRE( ( a - b ).value() == 4 );
+    REQUIRE( ( a * b ).value() == 21 );
+    REQUIRE( ( a / b ).value() == 2 );
+    REQUIRE( ( a % b ).value() == 1 );
+    REQUIRE( ( -a ).value() == -7 );
+    REQUIRE( a > b );
+    REQUIRE( a != b );
+    REQUIRE( wv::abs( -a ) == a );
+    REQUIRE( ( ++a ).value() == 8 );
+    REQUIRE( ( a-- ).value() == 8 );
+    REQUIRE( a.value() == 7 );
+    REQUIRE( a.unchecked().value() == 7 );
+    REQUIRE( Count( int_min ) % Count( -1 ) == Count( 0 ) );
+}
+
+TEST_CASE( "checked/arithmetic-throw",
+           "Overflow, and division by zero, throw with throw_on_overflow." )
+{
+    REQUIRE_THROWS_AS( Count( int_max ) + Count( 1 ), std::overflow_error );
+    REQUIRE_THROWS_AS( Count( int_min ) - Count( 1 ), std::overflow_error );
+    REQUIRE_THROWS_AS( Count( 65536 ) * Count( 65536 ), std::overflow_error );
+    REQUIRE_THROWS_AS( Count( int_min ) / Count( -1 ), std::overflow_error );
+    REQUIRE_THROWS_AS( Count( 1 ) / Count( 0 ), std::overflow_error );
+    REQUIRE_THROWS_AS( Count( 1 ) % Count( 0 ), std::overflow_error );
+    REQUIRE_THROWS_AS( -Count( int_min ), std::overflow_error );
+    REQUIRE_THROWS_AS( wv::abs( Count( int_min ) ), std::overflow_error );
+
+    Count c( int_max );
+    REQUIRE_THROWS_AS( ++c, std::overflow_error );
+    REQUIRE_THROWS_AS( c += Count( 1 ), std::overflow_error );
+
+    Index i( 0 );
+    REQUIRE_THROWS_AS( --i, std::overflow_error );
+    REQUIRE_THROWS_AS( Index( 1 ) - Index( 2 ), std::overflow_error );
+    REQUIRE_THROWS_AS( Index( 300 ) * Index( 300 ), std::overflow_error );
+}
+
+TEST_CASE( "checked/arithmetic-sticky",
+           "sticky_overflow sets a flag and yields the wrapped value." )
+{
+    wv::sticky_overflow::test_and_clear();
+
+    Small const a = Small( 100 ) + Small( 20 );
+    REQUIRE( !wv::sticky_overflow::test() );
+    REQUIRE( a.value() == 120 );
+
+    Small const b = a + Small( 10 );
+    REQUIRE( wv::sticky_overflow::test_and_clear() );
+    REQUIRE( b.value() == -126 );
+    REQUIRE( !wv::sticky_overflow::test() );
+
+    REQUIRE( ( Small( 5 ) / Small( 0 ) ).value() == 0 );
+    REQUIRE( wv::sticky_overflow::test_and_clear() );
+}
+
+/* ----------------------------------------------------------------------------
+ * checked_quantity:
+ */
+
+TEST_CASE( "checked/quantity",
+           "Quantity addition and scaling are checked; sub types keep the checks." )
+{
+    int64_t const big = std::numeric_limits<int64_t>::max() / 2 + 1;
+
+    REQUIRE( ( Volume( 5 ) * 3 ).value() == 15 );
+    REQUIRE( ( 3 * Volume( 5 ) ).value() == 15 );
+    REQUIRE( ( Volume( 15 ) / 4 ).value() == 3 );
+    REQUIRE( ( Volume( 15 ) % 4 ).value() == 3 );
+
+    REQUIRE_THROWS_AS( Volume( big ) * 2, std::overflow_error );
+    REQUIRE_THROWS_AS( Volume( big ) + Volume( big ), std::overflow_error );
+    REQUIRE_THROWS_AS( Volume( 1 ) / 0, std::overflow_error );
+
+    Shares const s( big );
+    REQUIRE_THROWS_AS( s + s, std::overflow_error );
+    REQUIRE( ( s - s ).value() == 0 );
+}
+
+TEST_CASE( "checked/quantity-callback",
+           "callback_on_overflow calls the installed handler." )
+{
+    wv::overflow_handler const previous = wv::set_overflow_handler( &record_overflow );
+
+    last_overflow.clear();
+    Ticks const t = Ticks( int_max ) * 2;
+
+    REQUIRE( last_overflow == "wv: overflow in multiplication" );
+    REQUIRE( t.value() == -2 );
+
+    wv::set_overflow_handler( previous );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,108 @@
+/*
+ * TestChrono.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_chrono.h"
+#include "whole_value_unit.h"
+
+#include <chrono>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+// Define fundamental value types:
+WV_DEFINE_DURATION_TYPE( Nanos, int64_t, std::nano )
+WV_DEFINE_DURATION_TYPE( Micros, int64_t, std::micro )
+WV_DEFINE_DURATION_TYPE( Seconds, double, std::ratio<1> )
+WV_DEFINE_TIME_POINT_TYPE( SteadyTime, Nanos, std::chrono::steady_clock )
+WV_DEFINE_TIME_POINT_TYPE( WallTime, Micros, std::chrono::system_clock )
+
+struct Time {};
+WV_DEFINE_SCALED_TYPE( Milliseconds, int64_t, Time, std::milli )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Latency, Nanos )
+
+// constexpr:
+static_assert( wv::to_duration( Nanos( 5 ) ).count() == 5, "to_duration is constexpr" );
+static_assert( wv::from_duration<Nanos>( std::chrono::microseconds( 3 ) ).value() == 3000, "from_duration is constexpr" );
+static_assert( wv::from_duration_cast<Micros>( std::chrono::nanoseconds( 3999 ) ).value() == 3, "from_duration_cast is constexpr" );
+
+TEST_CASE( "chrono/duration",
+           "Durations convert by the period of the tag." )
+{
+    REQUIRE( ( std::is_same< wv::duration_of<Nanos>, std::chrono::nanoseconds >::value ) );
+    REQUIRE( ( std::is_same< wv::duration_of<Micros>, std::chrono::microseconds >::value ) );
+    REQUIRE( ( std::is_same< wv::duration_of<Milliseconds>, std::chrono::milliseconds >::value ) );
+    REQUIRE( ( std::is_same< wv::duration_of<Latency>, std::chrono::nanoseconds >::value ) );
+
+    REQUIRE( wv::to_duration( Nanos( 1500 ) ) == std::chrono::nanoseconds( 1500 ) );
+    REQUIRE( wv::to_duration( Milliseconds( 7 ) ) == std::chrono::milliseconds( 7 ) );
+    REQUIRE( wv::to_duration( Latency( 9 ) ) == std::chrono::nanoseconds( 9 ) );
+
+    REQUIRE( wv::from_duration<Nanos>( std::chrono::milliseconds( 2 ) ) == Nanos( 2000000 ) );
+    REQUIRE( wv::from_duration<Seconds>( std::chrono::milliseconds( 2500 ) ) == Seconds( 2.5 ) );
+    REQUIRE( wv::from_duration<Milliseconds>( std::chrono::seconds( 3 ) ).value() == 3000 );
+    REQUIRE( wv::from_duration_cast<Micros>( std::chrono::nanoseconds( -2999 ) ) == Micros( -2 ) );
+}
+
+TEST_CASE( "chrono/time_point",
+           "Time points convert for the clock of the tag." )
+{
+    REQUIRE( ( std::is_same< wv::time_point_of<SteadyTime>, std::chrono::steady_clock::time_point >::value ) );
+
+    std::chrono::steady_clock::time_point const now = std::chrono::steady_clock::now();
+    SteadyTime const t = wv::from_time_point<SteadyTime>( now );
+
+    REQUIRE( t.value() == now.time_since_epoch().count() );
+    REQUIRE( wv::to_time_point( t ) == now );
+    REQUIRE( wv::to_time_point( t + Nanos( 1000 ) ) == now + std::chrono::microseconds( 1 ) );
+
+    std::chrono::time_point<std::chrono::system_clock, std::chrono::seconds> const epoch_plus_one( std::chrono::seconds( 1 ) );
+    REQUIRE( wv::from_time_point<WallTime>( epoch_plus_one ).value() == 1000000 );
+}
+
+TEST_CASE( "chrono/span",
+           "Spans of chrono values are viewed as spans of quantities without copying." )
+{
+    std::vector<std::chrono::nanoseconds> d;
+    for ( int i = 0; i < 10; ++i )
+        d.push_back( std::chrono::nanoseconds( i * 100 ) );
+
+    wv::span<Nanos> const q = wv::as_quantities<Nanos>( wv::make_span( d ) );
+    REQUIRE( q.size() == 10 );
+    REQUIRE( static_cast<void *>( q.data() ) == static_cast<void *>( &d[0] ) );
+    REQUIRE( q[3] == Nanos( 300 ) );
+
+    q[4] += Nanos( 1 );
+    REQUIRE( d[4].count() == 401 );
+
+    std::vector<std::chrono::nanoseconds> const & cd = d;
+    wv::span<Nanos const> const cq = wv::as_quantities<Nanos>( wv::make_span( cd ) );
+    REQUIRE( cq[9] == Nanos( 900 ) );
+    REQUIRE( wv::as_durations( cq )[2] == std::chrono::nanoseconds( 200 ) );
+
+    std::vector<std::chrono::steady_clock::time_point> tp( 3, std::chrono::steady_clock::time_point( std::chrono::nanoseconds( 42 ) ) );
+    wv::span<SteadyTime> const p = wv::as_points<SteadyTime>( wv::make_span( tp ) );
+    REQUIRE( p[1].value() == 42 );
+    p[2] += Nanos( 8 );
+    REQUIRE( tp[2].time_since_epoch().count() == 50 );
+    REQUIRE( wv::as_time_points( p )[0] == tp[0] );
+}
+
+/*
+ * end of file
+ */
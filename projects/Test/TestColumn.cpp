@@ -0,0 +1,240 @@
+/*
+ * TestColumn.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_column.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Price, Quant )
+
+/* ----------------------------------------------------------------------------
+ * parallel_for:
+ */
+
+TEST_CASE( "parallel/partition",
+           "Partitions cover the range exactly, in grain-sized steps." )
+{
+    const std::size_t n = 1000;
+    const unsigned threads = 7;
+
+    std::size_t next = 0;
+    for ( unsigned i = 0; i < threads; ++i )
+    {
+        wv::index_range r = wv::partition( 0, n, i, threads, 64 );
+        REQUIRE( r.first == next );
+        REQUIRE( ( r.first % 64 == 0 || r.first == n ) );
+        next = r.last;
+    }
+    REQUIRE( next == n );
+}
+
+TEST_CASE( "parallel/for",
+           "Every index is visited exactly once." )
+{
+    std::vector<int> hits( 10007, 0 );
+
+    wv::parallel_for( 0, hits.size(), 4, [&hits]( std::size_t first, std::size_t last, unsigned )
+    {
+        for ( std::size_t i = first; i < last; ++i )
+            ++hits[i];
+    }, 100 );
+
+    for ( std::size_t i = 0; i < hits.size(); ++i )
+        REQUIRE( hits[i] == 1 );
+}
+
+TEST_CASE( "parallel/exception",
+           "An exception of any thread reaches the caller after all threads finished." )
+{
+    std::vector<int> hits( 10007, 0 );
+
+    REQUIRE_THROWS_AS( wv::parallel_for( 0, hits.size(), 4, [&hits]( std::size_t first, std::size_t last, unsigned t )
+    {
+        for ( std::size_t i = first; i < last; ++i )
+            ++hits[i];
+        if ( t == 2 )
+            throw std::runtime_error( "worker" );
+    } ), std::runtime_error );
+
+    for ( std::size_t i = 0; i < hits.size(); ++i )
+        REQUIRE( hits[i] == 1 );
+
+    REQUIRE_THROWS_AS( wv::parallel_for( 0, hits.size(), 4, [&hits]( std::size_t first, std::size_t last, unsigned t )
+    {
+        if ( t == 0 )
+            throw std::logic_error( "caller" );
+        for ( std::size_t i = first; i < last; ++i )
+            ++hits[i];
+    } ), std::logic_error );
+
+    REQUIRE( hits[0] == 1 );
+    REQUIRE( hits.back() == 2 );
+}
+
+/* ----------------------------------------------------------------------------
+ * huge_page_allocator:
+ */
+
+TEST_CASE( "column/allocator",
+           "Huge page allocator serves small and huge-page aligned large blocks." )
+{
+    wv::huge_page_allocator<Quant> alloc;
+
+    SECTION( "column/allocator/small", "" )
+    {
+        Quant * p = alloc.allocate( 10 );
+        REQUIRE( p != 0 );
+        alloc.deallocate( p, 10 );
+    }
+
+    SECTION( "column/allocator/large", "" )
+    {
+        const std::size_t n = 3 * WV_HUGE_PAGE_SIZE / sizeof( Quant ) + 5;
+        Quant * p = alloc.allocate( n );
+        REQUIRE( p != 0 );
+#ifdef G_WV_HAVE_MMAP
+        REQUIRE( reinterpret_cast<std::size_t>( p ) % WV_HUGE_PAGE_SIZE == 0 );
+#endif
+        p[0] = Quant( 1 );
+        p[n-1] = Quant( 2 );
+        REQUIRE( p[0].value() + p[n-1].value() == 3 );
+        alloc.deallocate( p, n );
+    }
+
+    SECTION( "column/allocator/vector", "Usable as std::vector allocator." )
+    {
+        std::vector<Quant, wv::huge_page_allocator<Quant> > v( 1000000, Quant( 1.5 ) );
+        REQUIRE( v[999999].value() == 1.5 );
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * column:
+ */
+
+TEST_CASE( "column/construction",
+           "Column construction." )
+{
+    SECTION( "column/construction/default", "" )
+    {
+        wv::column<Price> c;
+        REQUIRE( c.empty() );
+        REQUIRE( c.size() == 0 );
+    }
+
+    SECTION( "column/construction/fill", "Every element is initialized, whatever the thread count." )
+    {
+        for ( unsigned threads = 1; threads <= 5; ++threads )
+        {
+            wv::column<Price> c( 700000, Price( 2.5 ), threads );
+            REQUIRE( c.size() == 700000 );
+            REQUIRE( c.threads() == threads );
+
+            double sum = 0;
+            for ( std::size_t i = 0; i < c.size(); ++i )
+                sum += c[i].value();
+            REQUIRE( sum == 2.5 * 700000 );
+        }
+    }
+
+    SECTION( "column/construction/copy-move", "" )
+    {
+        wv::column<Price> a( 1000, Price( 3 ), 2 );
+        a[7] = Price( 8 );
+
+        wv::column<Price> b( a );
+        REQUIRE( b[7].value() == 8 );
+        REQUIRE( b[8].value() == 3 );
+
+        wv::column<Price> c( std::move( b ) );
+        REQUIRE( b.empty() );
+        REQUIRE( c.size() == 1000 );
+        REQUIRE( c[7].value() == 8 );
+
+        a = c;
+        REQUIRE( a[7].value() == 8 );
+    }
+}
+
+namespace {
+
+    std::atomic<long> live( 0 );
+    std::atomic<long> copies_left( 0 );
+
+    /**
+     * counts its instances; a copy throws when copies_left runs out.
+     */
+    struct Fragile
+    {
+        Fragile() { ++live; }
+        Fragile( Fragile const & ) { if ( --copies_left < 0 ) throw std::runtime_error( "copy" ); ++live; }
+        ~Fragile() { --live; }
+    };
+}
+
+TEST_CASE( "column/exception",
+           "A throwing element constructor leaves no elements and no storage behind." )
+{
+    copies_left = 30000;
+    REQUIRE_THROWS_AS( wv::column<Fragile>( 100000, Fragile(), 4 ), std::runtime_error );
+    REQUIRE( live == 0 );
+
+    copies_left = 100000;
+    {
+        wv::column<Fragile> const a( 100000, Fragile(), 4 );
+        REQUIRE( live == 100000 );
+
+        copies_left = 60000;
+        REQUIRE_THROWS_AS( wv::column<Fragile>( a ), std::runtime_error );
+        REQUIRE( live == 100000 );
+    }
+    REQUIRE( live == 0 );
+}
+
+TEST_CASE( "column/partition",
+           "Scanning the partitions visits the whole column." )
+{
+    wv::column<Price> c( 3000000, Price( 1 ), 3 );
+
+    std::vector<double> sums( c.threads(), 0.0 );
+
+    c.for_each_partition( [&c, &sums]( std::size_t first, std::size_t last, unsigned t )
+    {
+        double s = 0;
+        for ( std::size_t i = first; i < last; ++i )
+            s += c[i].value();
+        sums[t] = s;
+    } );
+
+    double total = 0;
+    for ( unsigned t = 0; t < c.threads(); ++t )
+    {
+        REQUIRE( sums[t] == double( c.partition( t ).size() ) );
+        total += sums[t];
+    }
+    REQUIRE( total == 3000000.0 );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,180 @@
+/*
+ * TestDecimal.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_decimal.h"
+
+#include <cstring>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+
+// Define fundamental value types:
+WV_DEFINE_DECIMAL_TYPE( Money, 2, ::wv::round_to_nearest_even )
+WV_DEFINE_DECIMAL_TYPE( Rate, 4, ::wv::round_to_nearest )
+WV_DEFINE_DECIMAL_TYPE( Units, 0, ::wv::round_toward_zero )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Fee, Money )
+
+namespace {
+
+template< typename D >
+D parsed( char const * const text )
+{
+    D x;
+    char const * const last = text + std::strlen( text );
+    REQUIRE( parse( text, last, x ) == last );
+    return x;
+}
+
+template< typename D >
+bool fails( char const * const text )
+{
+    D x;
+    return parse( text, text + std::strlen( text ), x ) == text;
+}
+}
+
+TEST_CASE( "decimal/arithmetic",
+           "Addition and integer scaling are exact; division rounds to even." )
+{
+    Money const a = parsed<Money>( "0.10" );
+    Money const b = parsed<Money>( "0.20" );
+
+    REQUIRE( a + b == parsed<Money>( "0.30" ) );
+    REQUIRE( ( a + b ).value() == 30 );
+    REQUIRE( a * 3 == parsed<Money>( "0.30" ) );
+    REQUIRE( 3 * a - b == a );
+    REQUIRE( ( -a ).value() == -10 );
+    REQUIRE( wv::abs( -a ) == a );
+    REQUIRE( Money::from_integer( 7 ).value() == 700 );
+    REQUIRE( Money::from_real( 19.99 ).value() == 1999 );
+
+    REQUIRE( ( parsed<Money>( "0.05" ) / 2 ).value() == 2 );       // 0.025 -> 0.02
+    REQUIRE( ( parsed<Money>( "0.07" ) / 2 ).value() == 4 );       // 0.035 -> 0.04
+    REQUIRE( ( parsed<Money>( "-0.05" ) / 2 ).value() == -2 );
+    REQUIRE( ( parsed<Money>( "10.00" ) / 3 ).value() == 333 );
+    REQUIRE( ( parsed<Money>( "10.00" ) % 3 ).value() == 100 );
+
+    Money m = a;
+    m += b;
+    REQUIRE( to_real( m ) == 0.3 );
+    REQUIRE( to_integer( parsed<Money>( "2.50" ) ) == 2 );
+    REQUIRE( to_integer( parsed<Money>( "3.50" ) ) == 4 );
+    REQUIRE( to_integer( parsed<Rate>( "2.5" ) ) == 3 );
+
+    Fee const fee( a );
+    REQUIRE( fee + fee == b );
+}
+
+TEST_CASE( "decimal/scale",
+           "Scaling by a rational or decimal factor rounds once." )
+{
+    Money const price = parsed<Money>( "19.99" );
+
+    REQUIRE( scale( price, 21, 100 ) == parsed<Money>( "4.20" ) );         // 4.1979
+    REQUIRE( scale( price, 1, 8 ) == parsed<Money>( "2.50" ) );            // 2.49875
+    REQUIRE( scale( price, parsed<Rate>( "0.2100" ) ) == parsed<Money>( "4.20" ) );
+    REQUIRE( scale( parsed<Money>( "0.50" ), parsed<Rate>( "0.05" ) ) == parsed<Money>( "0.02" ) );   // 0.025
+    REQUIRE( scale( parsed<Money>( "0.70" ), parsed<Rate>( "0.05" ) ) == parsed<Money>( "0.04" ) );   // 0.035
+}
+
+TEST_CASE( "decimal/parse",
+           "Parsing accepts signs and rounds surplus decimals; it rejects malformed input." )
+{
+    REQUIRE( parsed<Money>( "12" ).value() == 1200 );
+    REQUIRE( parsed<Money>( "+12.3" ).value() == 1230 );
+    REQUIRE( parsed<Money>( "-0.01" ).value() == -1 );
+    REQUIRE( parsed<Money>( ".5" ).value() == 50 );
+    REQUIRE( parsed<Money>( "7." ).value() == 700 );
+    REQUIRE( parsed<Money>( "1.005" ).value() == 100 );
+    REQUIRE( parsed<Money>( "1.015" ).value() == 102 );
+    REQUIRE( parsed<Money>( "1.0050001" ).value() == 101 );
+    REQUIRE( parsed<Money>( "-1.015" ).value() == -102 );
+    REQUIRE( parsed<Rate>( "1.00005" ).value() == 10001 );
+    REQUIRE( parsed<Units>( "41.9" ).value() == 41 );
+    REQUIRE( parsed<Money>( "92233720368547758.07" ).value() == INT64_MAX );
+
+    REQUIRE( fails<Money>( "" ) );
+    REQUIRE( fails<Money>( "-" ) );
+    REQUIRE( fails<Money>( "." ) );
+    REQUIRE( fails<Money>( "abc" ) );
+    REQUIRE( parsed<Money>( "92233720368547758.074" ).value() == INT64_MAX );   // rounds down, in range
+    REQUIRE( parsed<Money>( "-92233720368547758.075" ).value() == -INT64_MAX - 1 );
+
+    REQUIRE( fails<Money>( "92233720368547758.075" ) );
+    REQUIRE( fails<Money>( "92233720368547758.08" ) );
+    REQUIRE( fails<Money>( "1000000000000000000000" ) );
+
+    Money x;
+    char const text[] = "3.25 EUR";
+    REQUIRE( parse( text, text + sizeof( text ) - 1, x ) == text + 4 );
+    REQUIRE( x.value() == 325 );
+}
+
+TEST_CASE( "decimal/format",
+           "Formatting writes exactly Digits decimals and round-trips." )
+{
+    REQUIRE( to_string( parsed<Money>( "12.3" ) ) == "12.30" );
+    REQUIRE( to_string( parsed<Money>( "-0.05" ) ) == "-0.05" );
+    REQUIRE( to_string( Money() ) == "0.00" );
+    REQUIRE( to_string( parsed<Units>( "-42" ) ) == "-42" );
+    REQUIRE( to_string( Money( INT64_MAX ) ) == "92233720368547758.07" );
+    REQUIRE( to_string( Money( -INT64_MAX - 1 ) ) == "-92233720368547758.08" );
+
+    std::ostringstream os;
+    os << parsed<Rate>( "0.2100" );
+    REQUIRE( os.str() == "0.2100" );
+
+    for ( int64_t v = -100000; v <= 100000; v += 7 )
+    {
+        std::string const s = to_string( Money( v ) );
+        REQUIRE( parsed<Money>( s.c_str() ).value() == v );
+    }
+}
+
+#ifdef G_WV_HAVE_INT128
+TEST_CASE( "decimal/int128",
+           "With 128-bit storage the range covers 38 digits." )
+{
+    struct Wide_tag {};
+    typedef wv::decimal<18, Wide_tag, wv::round_to_nearest_even, wv::int128_t> Wide;
+
+    Wide const a = parsed<Wide>( "123456789012.123456789012345678" );
+    REQUIRE( to_string( a + a ) == "246913578024.246913578024691356" );
+    REQUIRE( to_string( a / 2 ) == "61728394506.061728394506172839" );
+    REQUIRE( to_string( scale( a, 3, 1 ) ) == "370370367036.370370367037037034" );
+
+    // products beyond 128 bits:
+    Wide const b = Wide::from_integer( 1000000000000 );
+    REQUIRE( to_string( scale( b, 1000000000, 2000000000 ) ) == "500000000000.000000000000000000" );
+    REQUIRE( to_string( scale( -b, 1000000000, 2000000000 ) ) == "-500000000000.000000000000000000" );
+    REQUIRE( to_string( scale( b, -1000000000, 2000000000 ) ) == "-500000000000.000000000000000000" );
+    REQUIRE( to_string( scale( a, 100000000000, 300000000000 ) ) == "41152263004.041152263004115226" );
+    REQUIRE( to_string( scale( a, 100000000000, 700000000000 ) ) == "17636684144.589065255573192240" );     // ...239.71
+    REQUIRE( to_string( scale( -a, 100000000000, -700000000000 ) ) == "17636684144.589065255573192240" );
+    REQUIRE( to_string( scale( -a, 100000000000, 700000000000 ) ) == "-17636684144.589065255573192240" );
+
+    // scaled integers beyond the range of long long:
+    REQUIRE( to_string( Wide::from_real( 32.0 ) ) == "32.000000000000000000" );
+    REQUIRE( to_string( Wide::from_real( -32.0 ) ) == "-32.000000000000000000" );
+}
+#endif
+
+/*
+ * end of file
+ */
@@ -0,0 +1,107 @@
+/*
+ * TestDimension.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_dimension.h"
+
+#include <type_traits>
+#include <utility>
+
+// Define fundamental value types; exponents of length, mass, time:
+WV_DEFINE_DIMENSION_TYPE( Distance, double, 1 )
+WV_DEFINE_DIMENSION_TYPE( Mass, double, 0, 1 )
+WV_DEFINE_DIMENSION_TYPE( Time, double, 0, 0, 1 )
+WV_DEFINE_DIMENSION_TYPE( Speed, double, 1, 0, -1 )
+WV_DEFINE_DIMENSION_TYPE( Acceleration, double, 1, 0, -2 )
+WV_DEFINE_DIMENSION_TYPE( Force, double, 1, 1, -2 )
+WV_DEFINE_DIMENSION_TYPE( Energy, double, 2, 1, -2 )
+WV_DEFINE_DIMENSION_TYPE( Area, double, 2, 0, 0 )
+WV_DEFINE_DIMENSION_TYPE( Frequency, double, 0, 0, -1 )
+
+WV_DEFINE_DIMENSION_TYPE( Millimetres, int, 1 )
+WV_DEFINE_DIMENSION_TYPE( SquareMillimetres, int, 2 )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Altitude, Distance )
+
+namespace {
+
+template< typename A, typename B, typename = void >
+struct can_add : std::false_type {};
+
+template< typename A, typename B >
+struct can_add< A, B, decltype( void( std::declval<A>() + std::declval<B>() ) ) > : std::true_type {};
+}
+
+TEST_CASE( "dimension/types",
+           "Products and quotients have the dimension of the result." )
+{
+    REQUIRE( ( std::is_same< Area, wv::quantity<double, wv::dimension<2> > >::value ) );
+    REQUIRE( ( std::is_same< Time, wv::quantity<double, wv::si::time> >::value ) );
+    REQUIRE( ( std::is_same< wv::make_dimension<1, 0, 0, 0>, wv::dimension<1> >::value ) );
+    REQUIRE( ( std::is_same< wv::make_dimension<0, 0>, wv::dimension<> >::value ) );
+    REQUIRE( ( std::is_same< wv::dimension_quotient< wv::si::length, wv::si::time >, wv::dimension<1, 0, -1> >::value ) );
+    REQUIRE( ( std::is_same< wv::dimension_product< wv::dimension<0, 0, -1>, wv::si::time >, wv::dimension<> >::value ) );
+
+    REQUIRE( ( std::is_same< decltype( Distance() / Time() ), Speed >::value ) );
+    REQUIRE( ( std::is_same< decltype( Speed() / Time() ), Acceleration >::value ) );
+    REQUIRE( ( std::is_same< decltype( Mass() * Acceleration() ), Force >::value ) );
+    REQUIRE( ( std::is_same< decltype( Force() * Distance() ), Energy >::value ) );
+    REQUIRE( ( std::is_same< decltype( Distance() * Distance() ), Area >::value ) );
+    REQUIRE( ( std::is_same< decltype( Speed() * Time() ), Distance >::value ) );
+    REQUIRE( ( std::is_same< decltype( Distance() / Distance() ), double >::value ) );
+    REQUIRE( ( std::is_same< decltype( 1.0 / Time() ), Frequency >::value ) );
+    REQUIRE( ( std::is_same< decltype( Frequency() * Time() ), double >::value ) );
+    REQUIRE( ( std::is_same< decltype( Altitude() / Time() ), Speed >::value ) );
+
+    REQUIRE( ( can_add< Distance, Distance >::value ) );
+    REQUIRE( ( can_add< Distance, Altitude >::value ) );
+    REQUIRE( !( can_add< Distance, Time >::value ) );
+    REQUIRE( !( can_add< Speed, Acceleration >::value ) );
+
+    REQUIRE( sizeof( Energy ) == sizeof( double ) );
+}
+
+TEST_CASE( "dimension/values",
+           "Dimensioned operations compute like the underlying type." )
+{
+    Distance const d( 100.0 );
+    Time const t( 8.0 );
+    Mass const m( 2.0 );
+
+    Speed const v = d / t;
+    REQUIRE( v.value() == 12.5 );
+
+    Energy const e = m * v * v / 2.0;
+    REQUIRE( e.value() == 156.25 );
+
+    Acceleration const a = v / t;
+    REQUIRE( ( m * a ).value() == 3.125 );
+    REQUIRE( ( v * t + d ).value() == 200.0 );
+    REQUIRE( d / Distance( 25.0 ) == 4.0 );
+    REQUIRE( ( 2.0 / t ).value() == 0.25 );
+
+    Altitude const h( 50.0 );
+    REQUIRE( ( h * d ).value() == 5000.0 );
+
+    SquareMillimetres const s = Millimetres( 30 ) * Millimetres( 40 );
+    REQUIRE( s.value() == 1200 );
+    REQUIRE( s / Millimetres( 7 ) == Millimetres( 171 ) );
+}
+
+/*
+ * end of file
+ */
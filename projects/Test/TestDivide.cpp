@@ -0,0 +1,210 @@
+/*
+ * TestDivide.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_divide.h"
+#include "TestRandom.h"
+
+#include <limits>
+#include <stdint.h>
+#include <vector>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Nanos, int64_t )
+WV_DEFINE_QUANTITY_TYPE( Ticks, uint32_t )
+WV_DEFINE_ARITHMETIC_TYPE( Count, int32_t )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Latency, Nanos )
+
+namespace {
+
+/**
+ * compare divisor<T> with / and % for d and random and extreme dividends.
+ */
+template< typename T >
+bool matches_native( T const d, int const rounds )
+{
+    typedef std::numeric_limits<T> limits;
+
+    wv::divisor<T> const div( d );
+
+    xorshift64 next( 88172645463325252ull + uint64_t( d ) );
+    for ( int i = 0; i < rounds + 4; ++i )
+    {
+        T const x = i == 0 ? limits::max() : i == 1 ? limits::min() : i == 2 ? T( 0 ) : i == 3 ? T( limits::max() - 1 ) : T( next() );
+
+        // min / -1 overflows:
+        if ( limits::is_signed && x == limits::min() && d == T( -1 ) )
+            continue;
+
+        if ( x / div != T( x / d ) || x % div != T( x % d ) )
+            return false;
+    }
+    return true;
+}
+
+template< typename T >
+bool matches_native_for_divisors( int const rounds )
+{
+    typedef std::numeric_limits<T> limits;
+
+    T const special[] = { T( 1 ), T( 2 ), T( 3 ), T( 7 ), T( 10 ), T( 64 ), T( 100 ), T( 1000 ), limits::max(), T( limits::max() - 1 ), T( limits::max() / 2 ), T( limits::max() / 2 + 1 ) };
+
+    for ( unsigned i = 0; i < sizeof( special ) / sizeof( special[0] ); ++i )
+    {
+        if ( !matches_native( special[i], rounds ) )
+            return false;
+        if ( limits::is_signed && !matches_native( T( -special[i] ), rounds ) )
+            return false;
+    }
+    if ( limits::is_signed && !matches_native( limits::min(), rounds ) )
+        return false;
+
+    xorshift64 next( 2463534242ull );
+    for ( int i = 0; i < 200; ++i )
+    {
+        T d = T( next() >> ( next() % ( 8 * sizeof( T ) ) ) );
+        if ( d == 0 )
+            d = 1;
+        if ( !matches_native( d, rounds ) )
+            return false;
+    }
+    return true;
+}
+}
+
+TEST_CASE( "divide/quantity",
+           "A divisor divides quantity and arithmetic values like / and %." )
+{
+    wv::divisor<int64_t> const second( 1000000000 );
+
+    REQUIRE( second.value() == 1000000000 );
+    REQUIRE( Nanos( 3500000000ll ) / second == Nanos( 3 ) );
+    REQUIRE( Nanos( 3500000000ll ) % second == Nanos( 500000000 ) );
+    REQUIRE( Nanos( -3500000000ll ) / second == Nanos( -3 ) );
+    REQUIRE( Nanos( -3500000000ll ) % second == Nanos( -500000000 ) );
+
+    Latency const latency( 2999999999ll );
+    REQUIRE( latency / second == Nanos( 2 ) );
+
+    wv::divisor<uint32_t> const interval( 60 );
+    REQUIRE( Ticks( 3599 ) / interval == Ticks( 59 ) );
+    REQUIRE( Ticks( 3599 ) % interval == Ticks( 59 ) );
+
+    wv::divisor<int32_t> const minus_seven( -7 );
+    REQUIRE( Count( 50 ) / minus_seven == Count( -7 ) );
+    REQUIRE( Count( 50 ) % minus_seven == Count( 1 ) );
+    REQUIRE( Count( -50 ) / minus_seven == Count( 7 ) );
+    REQUIRE( Count( -50 ) % minus_seven == Count( -1 ) );
+
+    REQUIRE( 1000 / wv::divisor<int>( 1 ) == 1000 );
+    REQUIRE( 1000u / wv::divisor<unsigned>( 1024 ) == 0u );
+}
+
+TEST_CASE( "divide/exhaustive",
+           "8 and 16-bit divisors agree with / and % for all dividends." )
+{
+    bool all = true;
+    for ( int d = -128; d <= 127; ++d )
+    {
+        if ( d == 0 )
+            continue;
+        wv::divisor<int8_t> const div8( (int8_t) d );
+        for ( int x = -128; x <= 127; ++x )
+            if ( !( d == -1 && x == -128 ) && ( int8_t( x ) / div8 != int8_t( x / d ) || int8_t( x ) % div8 != int8_t( x % d ) ) )
+                all = false;
+    }
+    REQUIRE( all );
+
+    uint16_t const divisors[] = { 1, 2, 3, 5, 7, 255, 256, 641, 32767, 32768, 65535 };
+    for ( unsigned i = 0; i < sizeof( divisors ) / sizeof( divisors[0] ); ++i )
+    {
+        wv::divisor<uint16_t> const div16( divisors[i] );
+        for ( unsigned x = 0; x <= 65535; ++x )
+            if ( uint16_t( x ) / div16 != x / divisors[i] || uint16_t( x ) % div16 != x % divisors[i] )
+                all = false;
+    }
+    REQUIRE( all );
+}
+
+TEST_CASE( "divide/random",
+           "32 and 64-bit divisors agree with / and % for random operands." )
+{
+    REQUIRE( matches_native_for_divisors<uint32_t>( 2000 ) );
+    REQUIRE( matches_native_for_divisors<int32_t>( 2000 ) );
+    REQUIRE( matches_native_for_divisors<uint64_t>( 2000 ) );
+    REQUIRE( matches_native_for_divisors<int64_t>( 2000 ) );
+}
+
+TEST_CASE( "divide/bulk",
+           "divide() and remainder() process spans of whole values." )
+{
+    std::size_t const n = 1003;
+
+    std::vector<Ticks> t( n );
+    std::vector<Count> c( n );
+    std::vector<Nanos> ns( n );
+    xorshift64 next;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        uint64_t const r = next();
+        t[i] = Ticks( uint32_t( r ) );
+        c[i] = Count( int32_t( r >> 32 ) );
+        ns[i] = Nanos( int64_t( r ) );
+    }
+
+    uint32_t const tdivisors[] = { 1, 3, 60, 1u << 20, 4000000000u };
+    for ( unsigned k = 0; k < sizeof( tdivisors ) / sizeof( tdivisors[0] ); ++k )
+    {
+        wv::divisor<uint32_t> const d( tdivisors[k] );
+        std::vector<Ticks> q( n ), r( n );
+        divide( wv::make_span( t ), d, wv::make_span( q ) );
+        remainder( wv::make_span( t ), d, wv::make_span( r ) );
+
+        bool same = true;
+        for ( std::size_t i = 0; i < n; ++i )
+            same = same && q[i].value() == t[i].value() / tdivisors[k] && r[i].value() == t[i].value() % tdivisors[k];
+        REQUIRE( same );
+    }
+
+    int32_t const cdivisors[] = { 1, -1, 7, -1000, 65536, INT32_MIN };
+    for ( unsigned k = 0; k < sizeof( cdivisors ) / sizeof( cdivisors[0] ); ++k )
+    {
+        wv::divisor<int32_t> const d( cdivisors[k] );
+        std::vector<Count> q( n ), r( n );
+        divide( wv::make_span( c ), d, wv::make_span( q ) );
+        remainder( wv::make_span( c ), d, wv::make_span( r ) );
+
+        bool same = true;
+        for ( std::size_t i = 0; i < n; ++i )
+            same = same && q[i].value() == c[i].value() / cdivisors[k] && r[i].value() == c[i].value() % cdivisors[k];
+        REQUIRE( same );
+    }
+
+    wv::divisor<int64_t> const second( 1000000000 );
+    std::vector<Nanos> q( ns );
+    divide( wv::make_span( q ), second, wv::make_span( q ) );
+
+    bool same = true;
+    for ( std::size_t i = 0; i < n; ++i )
+        same = same && q[i].value() == ns[i].value() / 1000000000;
+    REQUIRE( same );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,186 @@
+/*
+ * TestFilter.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_filter.h"
+
+#include <random>
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+WV_DEFINE_ARITHMETIC_TYPE( Count, int32_t )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Price, Quant )
+
+namespace {
+
+struct Orders {};
+
+/**
+ * n prices and counts; sizes not a multiple of 64 exercise the tail.
+ */
+void make_orders( std::size_t const n, std::vector<Price> & price, std::vector<Count> & count )
+{
+    std::mt19937 rng( 7 );
+    price.clear();
+    count.clear();
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        price.push_back( Price( 0.25 * int( rng() % 400 ) ) );
+        count.push_back( Count( int32_t( rng() % 50 ) ) );
+    }
+}
+}
+
+/* ----------------------------------------------------------------------------
+ * mask:
+ */
+
+TEST_CASE( "filter/mask",
+           "Set, test, count and combine bits; bits beyond the size stay clear." )
+{
+    wv::mask<Orders> m( 70 );
+
+    REQUIRE( m.size() == 70u );
+    REQUIRE( m.none() );
+
+    m.set( 0 );
+    m.set( 64 );
+    m.set( 69 );
+
+    REQUIRE( m.count() == 3u );
+    REQUIRE( m[64] );
+    REQUIRE( !m[65] );
+
+    m.reset( 64 );
+    REQUIRE( m.count() == 2u );
+
+    wv::mask<Orders> const inv = ~m;
+    REQUIRE( inv.count() == 68u );
+    REQUIRE( ( inv & m ).none() );
+    REQUIRE( ( inv | m ) == wv::mask<Orders>( 70, true ) );
+    REQUIRE( ( inv ^ m ).count() == 70u );
+
+    std::vector<std::size_t> seen;
+    m.for_each( [&]( std::size_t i ) { seen.push_back( i ); } );
+    REQUIRE( seen.size() == 2u );
+    REQUIRE( seen[0] == 0u );
+    REQUIRE( seen[1] == 69u );
+}
+
+/* ----------------------------------------------------------------------------
+ * select:
+ */
+
+TEST_CASE( "filter/select",
+           "Compare kernels agree with a scalar loop." )
+{
+    std::vector<Price> price;
+    std::vector<Count> count;
+    make_orders( 1000 + 37, price, count );
+
+    wv::span<Price> const p = wv::make_span( price );
+    Price const limit( 50.0 );
+
+    wv::mask<Orders> const lt = wv::select_less<Orders>( p, limit );
+    wv::mask<Orders> const le = wv::select_less_equal<Orders>( p, limit );
+    wv::mask<Orders> const gt = wv::select_greater<Orders>( p, limit );
+    wv::mask<Orders> const ge = wv::select_greater_equal<Orders>( p, limit );
+    wv::mask<Orders> const eq = wv::select_equal<Orders>( p, limit );
+    wv::mask<Orders> const ne = wv::select_not_equal<Orders>( p, limit );
+
+    for ( std::size_t i = 0; i < price.size(); ++i )
+    {
+        double const x = price[i].value();
+        REQUIRE( lt[i] == ( x <  50.0 ) );
+        REQUIRE( le[i] == ( x <= 50.0 ) );
+        REQUIRE( gt[i] == ( x >  50.0 ) );
+        REQUIRE( ge[i] == ( x >= 50.0 ) );
+        REQUIRE( eq[i] == ( x == 50.0 ) );
+        REQUIRE( ne[i] == ( x != 50.0 ) );
+    }
+
+    REQUIRE( ( lt | ge ) == wv::mask<Orders>( price.size(), true ) );
+    REQUIRE( ( lt & ge ).none() );
+    REQUIRE( eq == ~ne );
+}
+
+TEST_CASE( "filter/select-if",
+           "Select with a predicate on the underlying value; combine predicates on different columns." )
+{
+    std::vector<Price> price;
+    std::vector<Count> count;
+    make_orders( 5000, price, count );
+
+    wv::mask<Orders> const m =
+        wv::select_if<Orders>( wv::make_span( price ), []( double x ) { return x > 20 && x < 80; } )
+        & wv::select_greater_equal<Orders>( wv::make_span( count ), Count( 10 ) );
+
+    std::size_t expected = 0;
+    for ( std::size_t i = 0; i < price.size(); ++i )
+    {
+        bool const sel = price[i].value() > 20 && price[i].value() < 80 && count[i].value() >= 10;
+        expected += sel;
+        REQUIRE( m[i] == sel );
+    }
+    REQUIRE( m.count() == expected );
+}
+
+/* ----------------------------------------------------------------------------
+ * compact:
+ */
+
+TEST_CASE( "filter/compact",
+           "Compaction yields the selected values and indices in row order, for sparse and dense masks." )
+{
+    std::vector<Price> price;
+    std::vector<Count> count;
+    make_orders( 3000 + 5, price, count );
+
+    double const limits[] = { -1.0, 1.0, 50.0, 98.0, 1000.0 };
+
+    for ( std::size_t l = 0; l < sizeof limits / sizeof limits[0]; ++l )
+    {
+        wv::mask<Orders> const m = wv::select_less<Orders>( wv::make_span( price ), Price( limits[l] ) );
+
+        std::vector<Price> const values = wv::compact( price, m );
+        std::vector<uint32_t> const rows = wv::compact_indices<uint32_t>( m );
+        std::vector<std::size_t> const rows2 = wv::compact_indices( m );
+
+        REQUIRE( values.size() == m.count() );
+        REQUIRE( rows.size() == m.count() );
+        REQUIRE( rows2.size() == m.count() );
+
+        std::size_t j = 0;
+        for ( std::size_t i = 0; i < price.size(); ++i )
+        {
+            if ( price[i].value() < limits[l] )
+            {
+                REQUIRE( values[j].value() == price[i].value() );
+                REQUIRE( rows[j] == i );
+                REQUIRE( rows2[j] == i );
+                ++j;
+            }
+        }
+        REQUIRE( j == values.size() );
+    }
+}
+
+/*
+ * end of file
+ */
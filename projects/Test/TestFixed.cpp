@@ -0,0 +1,158 @@
+/*
+ * TestFixed.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_fixed.h"
+
+#include <cmath>
+#include <stdint.h>
+#include <type_traits>
+
+// Define fundamental value types:
+WV_DEFINE_FIXED_TYPE( Price, int64_t, 16, ::wv::round_to_nearest )
+WV_DEFINE_FIXED_TYPE( Seconds, int32_t, 8, ::wv::round_toward_zero )
+WV_DEFINE_FIXED_TYPE( Factor, int32_t, 12, ::wv::round_to_nearest )
+WV_DEFINE_FIXED_TYPE( Half, int16_t, 1, ::wv::round_to_nearest )
+WV_DEFINE_FIXED_TYPE( HalfZero, int16_t, 1, ::wv::round_toward_zero )
+WV_DEFINE_FIXED_TYPE( HalfDown, int16_t, 1, ::wv::round_down )
+WV_DEFINE_FIXED_TYPE( HalfEven, int16_t, 1, ::wv::round_to_nearest_even )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Bid, Price )
+
+namespace {
+
+/**
+ * num / den rounded by the rules of the policy, computed in double.
+ */
+double reference( double const q, int const policy )
+{
+    double const t = std::trunc( q );
+    double const f = q - t;
+    switch ( policy )
+    {
+        case 0: return t;
+        case 1: return std::floor( q );
+        case 2: return std::round( q );
+        default: return std::fabs( f ) == 0.5 ? 2 * std::round( q / 2 ) : std::round( q );
+    }
+}
+
+template< typename R >
+bool divide_matches( int const policy )
+{
+    for ( int num = -50; num <= 50; ++num )
+        for ( int den = -9; den <= 9; ++den )
+            if ( den != 0 && wv::detail::divide<R>( num, den ) != reference( double( num ) / den, policy ) )
+                return false;
+    return true;
+}
+
+template< typename R >
+bool shift_matches( int const policy )
+{
+    for ( int x = -70; x <= 70; ++x )
+        for ( int n = 0; n <= 4; ++n )
+            if ( R::shift( x, n ) != reference( std::ldexp( double( x ), -n ), policy ) )
+                return false;
+    return true;
+}
+}
+
+TEST_CASE( "fixed/layout",
+           "A fixed value has the size of its underlying type and is trivially copyable." )
+{
+    REQUIRE( sizeof( Price ) == sizeof( int64_t ) );
+    REQUIRE( sizeof( Half ) == sizeof( int16_t ) );
+    REQUIRE( std::is_trivially_copyable<Price>::value );
+    REQUIRE( Price::one == 65536 );
+    REQUIRE( Price::frac_bits == 16 );
+}
+
+TEST_CASE( "fixed/quantity-operations",
+           "Fixed values add, subtract, compare and scale by integers like quantities." )
+{
+    Price const a = Price::from_real( 12.25 );
+    Price const b = Price::from_integer( 3 );
+
+    REQUIRE( a.value() == 12 * 65536 + 16384 );
+    REQUIRE( to_real( a + b ) == 15.25 );
+    REQUIRE( to_real( a - b ) == 9.25 );
+    REQUIRE( to_real( -a ) == -12.25 );
+    REQUIRE( to_real( a * 4 ) == 49.0 );
+    REQUIRE( to_real( 4 * a ) == 49.0 );
+    REQUIRE( to_real( a / 7 ) == 1.75 );
+    REQUIRE( to_real( a % 5 ) == 2.25 );
+    REQUIRE( a > b );
+    REQUIRE( a != b );
+    REQUIRE( wv::abs( -a ) == a );
+
+    Price c = b;
+    REQUIRE( to_real( ++c ) == 4.0 );
+    c += a;
+    REQUIRE( to_real( c ) == 16.25 );
+
+    Bid const bid( a );
+    REQUIRE( bid + bid == a * 2 );
+}
+
+TEST_CASE( "fixed/rounding-division",
+           "Division by an integer rounds after the policy." )
+{
+    REQUIRE( to_real( Half::from_integer( 5 ) / 2 ) == 2.5 );
+    REQUIRE( to_real( Half::from_integer( 5 ) / 4 ) == 1.5 );          // 1.25 -> 1.5 (ties away)
+    REQUIRE( to_real( HalfZero::from_integer( 5 ) / 4 ) == 1.0 );
+    REQUIRE( to_real( HalfDown::from_integer( -5 ) / 4 ) == -1.5 );
+    REQUIRE( to_real( HalfEven::from_integer( 5 ) / 4 ) == 1.0 );      // 1.25 -> 1.0 (ties to even)
+    REQUIRE( to_real( HalfEven::from_integer( 7 ) / 4 ) == 2.0 );      // 1.75 -> 2.0
+
+    REQUIRE( divide_matches<wv::round_toward_zero>( 0 ) );
+    REQUIRE( divide_matches<wv::round_down>( 1 ) );
+    REQUIRE( divide_matches<wv::round_to_nearest>( 2 ) );
+    REQUIRE( divide_matches<wv::round_to_nearest_even>( 3 ) );
+}
+
+TEST_CASE( "fixed/rounding-shift",
+           "Division by a power of two rounds like division." )
+{
+    REQUIRE( shift_matches<wv::round_toward_zero>( 0 ) );
+    REQUIRE( shift_matches<wv::round_down>( 1 ) );
+    REQUIRE( shift_matches<wv::round_to_nearest>( 2 ) );
+    REQUIRE( shift_matches<wv::round_to_nearest_even>( 3 ) );
+
+    REQUIRE( to_integer( Seconds::from_real( -2.75 ) ) == -2 );
+    REQUIRE( to_integer( Price::from_real( -2.5 ) ) == -3 );
+    REQUIRE( to_integer( HalfEven::from_real( 2.5 ) ) == 2 );
+    REQUIRE( to_integer( HalfEven::from_real( 3.5 ) ) == 4 );
+}
+
+TEST_CASE( "fixed/scale",
+           "Scaling by a rational or fixed factor uses a wide intermediate." )
+{
+    Seconds const s = Seconds::from_integer( 10 );
+
+    REQUIRE( to_real( scale( s, 1, 3 ) ) == std::trunc( 10.0 / 3 * 256 ) / 256 );
+    REQUIRE( to_real( scale( s, 3000000, 1000000 ) ) == 30.0 );
+
+    Price const p = Price::from_real( 1000000.5 );
+    REQUIRE( to_real( scale( p, 200000, 100000 ) ) == 2000001.0 );
+    REQUIRE( to_real( scale( p, Factor::from_real( 0.25 ) ) ) == 250000.125 );
+    REQUIRE( to_real( scale( Seconds::from_real( 1.5 ), Factor::from_real( -0.5 ) ) ) == -0.75 );
+}
+
+/*
+ * end of file
+ */
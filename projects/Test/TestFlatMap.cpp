@@ -0,0 +1,117 @@
+/*
+ * TestFlatMap.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_flat_map.h"
+
+#include <map>
+#include <random>
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_VALUE_TYPE( OrderId, uint64_t )
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+
+typedef wv::flat_map< OrderId, Price > Orders;
+
+/* ----------------------------------------------------------------------------
+ * flat_map:
+ */
+
+TEST_CASE( "flat_map/construction",
+           "Flat map construction." )
+{
+    Orders m;
+    REQUIRE( m.empty() );
+    REQUIRE( m.find( OrderId( 1 ) ) == 0 );
+
+    m.reserve( 100 );
+    REQUIRE( m.capacity() * 7 / 8 >= 100 );
+    REQUIRE( m.empty() );
+}
+
+TEST_CASE( "flat_map/insert-find",
+           "Insert and look up." )
+{
+    Orders m;
+
+    std::pair<Price *, bool> r = m.insert( OrderId( 1 ), Price( 1.5 ) );
+    REQUIRE( r.second );
+    REQUIRE( r.first->value() == 1.5 );
+
+    r = m.insert( OrderId( 1 ), Price( 9 ) );
+    REQUIRE( !r.second );
+    REQUIRE( r.first->value() == 1.5 );
+
+    m[ OrderId( 2 ) ] = Price( 2.5 );
+    REQUIRE( m.size() == 2 );
+    REQUIRE( m.find( OrderId( 2 ) )->value() == 2.5 );
+    REQUIRE( m.contains( OrderId( 1 ) ) );
+    REQUIRE( !m.contains( OrderId( 3 ) ) );
+}
+
+TEST_CASE( "flat_map/erase",
+           "Erase leaves other keys reachable." )
+{
+    Orders m;
+    for ( uint64_t i = 0; i < 100; ++i )
+        m[ OrderId( i ) ] = Price( double( i ) );
+
+    for ( uint64_t i = 0; i < 100; i += 2 )
+        REQUIRE( m.erase( OrderId( i ) ) );
+
+    REQUIRE( !m.erase( OrderId( 0 ) ) );
+    REQUIRE( m.size() == 50 );
+
+    for ( uint64_t i = 0; i < 100; ++i )
+        REQUIRE( m.contains( OrderId( i ) ) == ( i % 2 == 1 ) );
+
+    double sum = 0;
+    m.for_each( [&sum]( OrderId const &, Price & p ) { sum += p.value(); } );
+    REQUIRE( sum == 2500 );
+}
+
+TEST_CASE( "flat_map/random",
+           "Random inserts and erasures agree with std::map." )
+{
+    Orders m;
+    std::map< uint64_t, double > ref;
+    std::mt19937 rng( 7 );
+
+    for ( int i = 0; i < 200000; ++i )
+    {
+        uint64_t const k = rng() % 5000;
+
+        if ( rng() % 3 == 0 )
+        {
+            REQUIRE( m.erase( OrderId( k ) ) == ( ref.erase( k ) == 1 ) );
+        }
+        else
+        {
+            m[ OrderId( k ) ] = Price( double( i ) );
+            ref[ k ] = double( i );
+        }
+    }
+
+    REQUIRE( m.size() == ref.size() );
+
+    for ( std::map< uint64_t, double >::const_iterator it = ref.begin(); it != ref.end(); ++it )
+        REQUIRE( m.find( OrderId( it->first ) )->value() == it->second );
+}
+
+/*
+ * end of file
+ */
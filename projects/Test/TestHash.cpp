@@ -0,0 +1,114 @@
+/*
+ * TestHash.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_hash.h"
+
+#include <set>
+#include <stdint.h>
+#include <unordered_map>
+#include <unordered_set>
+
+// Define fundamental value types:
+WV_DEFINE_VALUE_TYPE( OrderId, uint64_t )
+WV_DEFINE_BITS_TYPE( Flags, unsigned )
+WV_DEFINE_ARITHMETIC_TYPE( Count, int )
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+WV_DEFINE_SAFE_BOOL_TYPE( Active )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Bid, Price )
+WV_DEFINE_TYPE( CustomerId, OrderId )
+
+WV_DEFINE_HASH( Bid )
+WV_DEFINE_HASH( CustomerId )
+
+WV_DEFINE_VALUE_TYPE( SeededId, uint64_t )
+
+namespace wv {
+template<> struct hash_seed< SeededId_tag > { static uint64_t value() { return 0x1234; } };
+}
+
+/* ----------------------------------------------------------------------------
+ * hash:
+ */
+
+TEST_CASE( "hash/std",
+           "std::hash is specialized for all families." )
+{
+    REQUIRE( std::hash<OrderId>()( OrderId( 7 ) ) == wv::hash<OrderId>()( OrderId( 7 ) ) );
+    REQUIRE( std::hash<Flags>()( Flags( 7 ) ) == std::hash<Flags>()( Flags( 7 ) ) );
+    REQUIRE( std::hash<Count>()( Count( 7 ) ) != std::hash<Count>()( Count( 8 ) ) );
+    REQUIRE( std::hash<Price>()( Price( 7 ) ) != std::hash<Price>()( Price( 8 ) ) );
+    REQUIRE( std::hash<Active>()( Active( true ) ) != std::hash<Active>()( Active( false ) ) );
+    REQUIRE( wv::hash<Bid>()( Bid( 7 ) ) == std::hash<Price>()( Price( 7 ) ) );
+    REQUIRE( std::hash<Bid>()( Bid( 7 ) ) == std::hash<Price>()( Price( 7 ) ) );
+    REQUIRE( std::hash<CustomerId>()( CustomerId( 7 ) ) == std::hash<OrderId>()( OrderId( 7 ) ) );
+}
+
+TEST_CASE( "hash/zero",
+           "-0.0 and 0.0 compare equal and hash equal." )
+{
+    REQUIRE( std::hash<Price>()( Price( -0.0 ) ) == std::hash<Price>()( Price( 0.0 ) ) );
+}
+
+TEST_CASE( "hash/seed",
+           "A tag may have its own seed." )
+{
+    REQUIRE( wv::hash<SeededId>()( SeededId( 1 ) ) != wv::hash<OrderId>()( OrderId( 1 ) ) );
+}
+
+TEST_CASE( "hash/spread",
+           "Consecutive ids spread over the low bits." )
+{
+    std::set<std::size_t> buckets;
+    for ( uint64_t i = 0; i < 64; ++i )
+        buckets.insert( std::hash<OrderId>()( OrderId( i * 1024 ) ) % 64 );
+
+    // identity hash would put all 64 keys in one bucket:
+    REQUIRE( buckets.size() > 32 );
+}
+
+TEST_CASE( "hash/unordered",
+           "Whole values as keys of unordered containers." )
+{
+    std::unordered_map< OrderId, Price > orders;
+    orders[ OrderId( 1 ) ] = Price( 1.5 );
+    orders[ OrderId( 2 ) ] = Price( 2.5 );
+    REQUIRE( orders.size() == 2 );
+    REQUIRE( orders[ OrderId( 1 ) ].value() == 1.5 );
+
+    std::unordered_set< Bid, wv::hash<Bid>, wv::equal_to<Bid> > bids;
+    bids.insert( Bid( 3 ) );
+    REQUIRE( bids.count( Bid( 3 ) ) == 1 );
+
+    // sub types with WV_DEFINE_HASH:
+    std::unordered_map< CustomerId, Bid > best;
+    best[ CustomerId( 4 ) ] = Bid( 4.5 );
+    best[ CustomerId( 5 ) ] = Bid( 5.5 );
+    best[ CustomerId( 4 ) ] = Bid( 6.5 );
+    REQUIRE( best.size() == 2 );
+    REQUIRE( best[ CustomerId( 4 ) ].value() == 6.5 );
+
+    std::unordered_set< Bid > asks;
+    asks.insert( Bid( 1 ) );
+    asks.insert( Bid( 1 ) );
+    REQUIRE( asks.size() == 1 );
+}
+
+/*
+ * end of file
+ */
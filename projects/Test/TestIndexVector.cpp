@@ -0,0 +1,140 @@
+/*
+ * TestIndexVector.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_index_vector.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_ARITHMETIC_TYPE( NodeIndex, uint32_t )
+WV_DEFINE_ARITHMETIC_TYPE( EdgeIndex, uint32_t )
+WV_DEFINE_QUANTITY_TYPE( Weight, double )
+
+typedef wv::index_vector< NodeIndex, Weight > NodeWeights;
+typedef wv::index_vector< EdgeIndex, NodeIndex > EdgeTargets;
+
+/* ----------------------------------------------------------------------------
+ * index_vector:
+ */
+
+TEST_CASE( "index_vector/construction",
+           "Index vector construction." )
+{
+    SECTION( "index_vector/construction/default", "" )
+    {
+        NodeWeights w;
+        REQUIRE( w.empty() );
+        REQUIRE( w.size().value() == 0u );
+    }
+
+    SECTION( "index_vector/construction/size", "" )
+    {
+        NodeWeights w( NodeIndex( 3 ), Weight( 1.5 ) );
+        REQUIRE( w.size().value() == 3u );
+        REQUIRE( w[ NodeIndex( 2 ) ].value() == 1.5 );
+    }
+}
+
+TEST_CASE( "index_vector/access",
+           "Typed index access." )
+{
+    NodeWeights w;
+    NodeIndex a = w.push_back( Weight( 1 ) );
+    NodeIndex b = w.emplace_back( 2.0 );
+
+    REQUIRE( a.value() == 0u );
+    REQUIRE( b.value() == 1u );
+    REQUIRE( w[ b ].value() == 2 );
+
+    w[ a ] = Weight( 5 );
+    REQUIRE( w.front().value() == 5 );
+    REQUIRE( w.index_of( w.end() - 1 ).value() == 1u );
+}
+
+TEST_CASE( "index_vector/indices",
+           "Loop over typed indices." )
+{
+    EdgeTargets targets;
+    for ( uint32_t i = 0; i < 10; ++i )
+        targets.push_back( NodeIndex( 10 - i ) );
+
+    uint32_t sum = 0;
+    for ( EdgeIndex e : targets.indices() )
+        sum += targets[ e ].value();
+
+    REQUIRE( sum == 55u );
+    REQUIRE( targets.indices().size().value() == 10u );
+}
+
+TEST_CASE( "index_vector/index-iterator",
+           "Index iterators are random access and work with the standard algorithms." )
+{
+    typedef wv::index_interval<EdgeIndex>::iterator iterator;
+
+    wv::index_interval<EdgeIndex> const all( 0, 10 );
+    iterator const first = all.begin();
+    iterator const last = all.end();
+
+    REQUIRE( 3 + first == first + 3 );
+    REQUIRE( ( *( 3 + first ) ).value() == 3u );
+    REQUIRE( first[4].value() == 4u );
+    REQUIRE( last > first );
+    REQUIRE( first <= first );
+    REQUIRE( last >= first + 10 );
+    REQUIRE( !( first > last ) );
+    REQUIRE( !( last <= first ) );
+    REQUIRE( std::distance( first, last ) == 10 );
+
+    std::reverse_iterator<iterator> const r( last ), rend( first );
+    REQUIRE( ( *r ).value() == 9u );
+    REQUIRE( r < rend );
+    REQUIRE( rend >= r );
+    REQUIRE( rend - r == 10 );
+
+    REQUIRE( std::lower_bound( first, last, EdgeIndex( 6 ) ) - first == 6 );
+}
+
+TEST_CASE( "index_vector/bounds",
+           "Bounds check policies." )
+{
+    SECTION( "index_vector/bounds/throw", "" )
+    {
+        wv::index_vector< NodeIndex, Weight, wv::throw_bounds_check > w( NodeIndex( 2 ) );
+        REQUIRE_NOTHROW( w[ NodeIndex( 1 ) ] );
+        REQUIRE_THROWS_AS( w[ NodeIndex( 2 ) ], std::out_of_range );
+    }
+
+    SECTION( "index_vector/bounds/at", "" )
+    {
+        wv::index_vector< NodeIndex, Weight, wv::no_bounds_check > w( NodeIndex( 2 ) );
+        REQUIRE_THROWS_AS( w.at( NodeIndex( 2 ) ), std::out_of_range );
+    }
+}
+
+TEST_CASE( "index_vector/footprint",
+           "32-bit typed indices take 32 bits." )
+{
+    REQUIRE( sizeof( NodeIndex ) == 4 );
+    REQUIRE( EdgeTargets::max_size() == 0xffffffffu );
+}
+
+/*
+ * end of file
+ */
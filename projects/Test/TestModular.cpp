@@ -0,0 +1,141 @@
+/*
+ * TestModular.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_modular.h"
+#include "TestRandom.h"
+
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_MODULAR_TYPE( Residue, uint32_t, 1000000007u )
+WV_DEFINE_MODULAR_TYPE( Shard, uint32_t, 0 )
+WV_DEFINE_MODULAR_TYPE( Bucket, uint32_t, 0 )
+
+#ifdef G_WV_HAVE_INT128
+WV_DEFINE_MODULAR_TYPE( Hash61, uint64_t, ( uint64_t( 1 ) << 61 ) - 1 )
+WV_DEFINE_MODULAR_TYPE( Wide, uint64_t, 0 )
+#endif
+
+namespace {
+
+/**
+ * compare the operations of Q with % for random operands.
+ */
+template< typename Q >
+bool matches_remainder( int const rounds )
+{
+    typedef typename Q::value_type T;
+    uint64_t const m = Q::modulus();
+
+    xorshift64 next;
+    for ( int i = 0; i < rounds; ++i )
+    {
+        T const a = T( next() ), b = T( next() );
+        Q const x( a ), y( b );
+
+        if ( x.value() != a % m || y.value() != b % m )
+            return false;
+        if ( ( x + y ).value() != ( x.value() + y.value() ) % m )
+            return false;
+        if ( ( x - y ).value() != ( x.value() + m - y.value() ) % m )
+            return false;
+#ifdef G_WV_HAVE_INT128
+        if ( ( x * y ).value() != T( ( wv::uint128_t( x.value() ) * y.value() ) % m ) )
+            return false;
+#endif
+    }
+    return true;
+}
+}
+
+TEST_CASE( "modular/compile-time",
+           "Values stay reduced modulo a compile-time modulus." )
+{
+    uint32_t const p = 1000000007u;
+
+    REQUIRE( sizeof( Residue ) == sizeof( uint32_t ) );
+    REQUIRE( Residue::modulus() == p );
+    REQUIRE( Residue( p ).value() == 0 );
+    REQUIRE( Residue( 4000000000u ).value() == 4000000000u % p );
+    REQUIRE( ( Residue( p - 1 ) + Residue( 2 ) ).value() == 1 );
+    REQUIRE( ( Residue( 1 ) - Residue( 2 ) ).value() == p - 1 );
+    REQUIRE( ( -Residue( 5 ) ).value() == p - 5 );
+    REQUIRE( ( -Residue( 0 ) ).value() == 0 );
+    REQUIRE( ( Residue( 123456789 ) * Residue( 987654321 ) ).value() == uint64_t( 123456789 ) * 987654321 % p );
+
+    Residue r( p - 1 );
+    REQUIRE( ( ++r ).value() == 0 );
+    REQUIRE( ( r-- ).value() == 0 );
+    REQUIRE( r.value() == p - 1 );
+
+    // Fermat: a^(p-1) = 1 for prime p:
+    REQUIRE( pow( Residue( 2 ), p - 1 ).value() == 1 );
+    REQUIRE( ( pow( Residue( 3 ), p - 2 ) * Residue( 3 ) ).value() == 1 );
+
+    REQUIRE( matches_remainder<Residue>( 100000 ) );
+}
+
+TEST_CASE( "modular/run-time",
+           "A run-time modulus is set once per tag." )
+{
+    Shard::set_modulus( 12 );
+    Bucket::set_modulus( 1u << 31 );
+
+    REQUIRE( Shard::modulus() == 12 );
+    REQUIRE( Shard( 100 ).value() == 4 );
+    REQUIRE( ( Shard( 7 ) + Shard( 9 ) ).value() == 4 );
+    REQUIRE( ( Shard( 7 ) * Shard( 9 ) ).value() == 3 );
+    REQUIRE( ( Shard( 3 ) - Shard( 9 ) ).value() == 6 );
+    REQUIRE( matches_remainder<Shard>( 100000 ) );
+
+    REQUIRE( Bucket( 0xffffffffu ).value() == 0x7fffffffu );
+    REQUIRE( ( Bucket( 0x7fffffffu ) + Bucket( 0x7fffffffu ) ).value() == 0x7ffffffeu );
+    REQUIRE( matches_remainder<Bucket>( 100000 ) );
+
+    uint32_t const moduli[] = { 1, 2, 3, 10, 65537, 999999937u, 2147483647u };
+    for ( unsigned i = 0; i < sizeof( moduli ) / sizeof( moduli[0] ); ++i )
+    {
+        Shard::set_modulus( moduli[i] );
+        REQUIRE( matches_remainder<Shard>( 20000 ) );
+        REQUIRE( Shard( 0xffffffffu ).value() == 0xffffffffu % moduli[i] );
+    }
+}
+
+#ifdef G_WV_HAVE_INT128
+TEST_CASE( "modular/64-bit",
+           "64-bit residues reduce 128-bit products." )
+{
+    uint64_t const p = ( uint64_t( 1 ) << 61 ) - 1;
+
+    REQUIRE( sizeof( Hash61 ) == sizeof( uint64_t ) );
+    REQUIRE( Hash61( ~uint64_t( 0 ) ).value() == ~uint64_t( 0 ) % p );
+    REQUIRE( ( Hash61( p - 1 ) * Hash61( p - 1 ) ).value() == 1 );
+    REQUIRE( pow( Hash61( 3 ), p - 1 ).value() == 1 );
+    REQUIRE( matches_remainder<Hash61>( 100000 ) );
+
+    uint64_t const moduli[] = { 1, 7, 1000000007u, 0x100000001ull, ( uint64_t( 1 ) << 63 ) - 25, uint64_t( 1 ) << 63 };
+    for ( unsigned i = 0; i < sizeof( moduli ) / sizeof( moduli[0] ); ++i )
+    {
+        Wide::set_modulus( moduli[i] );
+        REQUIRE( matches_remainder<Wide>( 20000 ) );
+    }
+}
+#endif
+
+/*
+ * end of file
+ */
@@ -0,0 +1,143 @@
+/*
+ * TestOptional.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_optional.h"
+
+#include <climits>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+WV_DEFINE_QUANTITY_TYPE( Count, int32_t )
+WV_DEFINE_QUANTITY_TYPE( Id, uint32_t )
+WV_DEFINE_QUANTITY_TYPE( Level, int16_t )
+
+WV_DEFINE_OPTIONAL_TYPE( OptionalPrice, Price, wv::nan_sentinel )
+WV_DEFINE_OPTIONAL_TYPE( OptionalCount, Count, wv::lowest_sentinel )
+WV_DEFINE_OPTIONAL_TYPE( OptionalId, Id, wv::all_ones_sentinel )
+WV_DEFINE_OPTIONAL_TYPE( OptionalLevel, Level, wv::value_sentinel<-1> )
+
+struct Rows {};
+
+TEST_CASE( "optional/layout",
+           "An optional has the size of its whole value." )
+{
+    REQUIRE( sizeof( OptionalPrice ) == sizeof( double ) );
+    REQUIRE( sizeof( OptionalCount ) == sizeof( int32_t ) );
+    REQUIRE( sizeof( OptionalId ) == sizeof( uint32_t ) );
+    REQUIRE( sizeof( OptionalLevel ) == sizeof( int16_t ) );
+
+    REQUIRE( ( std::is_same< wv::optional<Price>, OptionalPrice >::value ) );
+    REQUIRE( ( std::is_same< wv::optional<Count>, OptionalCount >::value ) );
+    REQUIRE( ( std::is_same< wv::optional<Id>, OptionalId >::value ) );
+    REQUIRE( std::is_trivially_copyable<OptionalPrice>::value );
+}
+
+TEST_CASE( "optional/value",
+           "An optional holds a value or the sentinel." )
+{
+    OptionalPrice p;
+    REQUIRE( !p.has_value() );
+    REQUIRE( !p );
+    REQUIRE( p.value_or( Price( 1.5 ) ) == Price( 1.5 ) );
+
+    p = Price( 2.5 );
+    REQUIRE( p.has_value() );
+    REQUIRE( bool( p ) );
+    REQUIRE( p.value() == Price( 2.5 ) );
+    REQUIRE( p.value_or( Price( 1.5 ) ) == Price( 2.5 ) );
+
+    p.reset();
+    REQUIRE( !p.has_value() );
+
+    OptionalCount c;
+    REQUIRE( !c.has_value() );
+    REQUIRE( values( wv::make_span( &c, 1 ) )[0] == INT_MIN );
+    c = Count( 0 );
+    REQUIRE( c.has_value() );
+    REQUIRE( OptionalCount( Count( INT_MIN + 1 ) ).has_value() );
+
+    OptionalId i;
+    REQUIRE( values( wv::make_span( &i, 1 ) )[0] == 0xffffffffu );
+    REQUIRE( OptionalId( Id( 0 ) ).value() == Id( 0 ) );
+
+    OptionalLevel l;
+    REQUIRE( !l.has_value() );
+    REQUIRE( OptionalLevel( Level( -2 ) ).has_value() );
+}
+
+TEST_CASE( "optional/compare",
+           "Optionals are equal when both are empty or hold the same value." )
+{
+    REQUIRE( OptionalPrice() == OptionalPrice() );
+    REQUIRE( OptionalPrice( Price( 1 ) ) == OptionalPrice( Price( 1 ) ) );
+    REQUIRE( OptionalPrice( Price( 1 ) ) != OptionalPrice( Price( 2 ) ) );
+    REQUIRE( OptionalPrice( Price( 1 ) ) != OptionalPrice() );
+    REQUIRE( OptionalCount() == OptionalCount() );
+    REQUIRE( OptionalCount( Count( 0 ) ) != OptionalCount() );
+
+    OptionalCount a( Count( 7 ) ), b;
+    swap( a, b );
+    REQUIRE( !a.has_value() );
+    REQUIRE( b.value() == Count( 7 ) );
+}
+
+TEST_CASE( "optional/bulk",
+           "count_values(), select_values() and value_or() test a span for the sentinel." )
+{
+    std::size_t const n = 1001;
+
+    std::vector<OptionalPrice> p( n );
+    std::vector<OptionalCount> c( n );
+    std::size_t expected = 0;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        if ( i % 7 == 3 )
+        {
+            p[i] = Price( double( i ) );
+            c[i] = Count( int32_t( i ) - 500 );
+            ++expected;
+        }
+    }
+
+    REQUIRE( wv::count_values( wv::make_span( p ) ) == expected );
+    REQUIRE( wv::count_values( wv::make_span( c ) ) == expected );
+
+    std::vector<OptionalPrice> const & cp = p;
+    wv::mask<Rows> const m = wv::select_values<Rows>( wv::make_span( cp ) );
+    REQUIRE( m.size() == n );
+    REQUIRE( m.count() == expected );
+
+    bool same = true;
+    for ( std::size_t i = 0; i < n; ++i )
+        same = same && m[i] == ( i % 7 == 3 );
+    REQUIRE( same );
+
+    std::vector<Price> out( n );
+    wv::value_or( wv::make_span( cp ), Price( -1 ), wv::make_span( out ) );
+
+    same = true;
+    for ( std::size_t i = 0; i < n; ++i )
+        same = same && out[i] == ( i % 7 == 3 ? Price( double( i ) ) : Price( -1 ) );
+    REQUIRE( same );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,161 @@
+/*
+ * TestPacked.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_packed.h"
+#include "TestRandom.h"
+
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+// Define fundamental value types:
+WV_DEFINE_ARITHMETIC_TYPE( Code, uint32_t )
+WV_DEFINE_QUANTITY_TYPE( Small, uint16_t )
+WV_DEFINE_QUANTITY_TYPE( Wide, uint64_t )
+
+struct Rows {};
+
+namespace {
+
+    template< typename Q >
+    std::vector<Q> sample( std::size_t const n, unsigned const bits )
+    {
+        uint64_t const mask = ( uint64_t( 1 ) << bits ) - 1;
+        xorshift64 next;
+
+        std::vector<Q> v( n );
+        for ( std::size_t i = 0; i < n; ++i )
+            v[i] = Q( typename Q::value_type( next() & mask ) );
+        return v;
+    }
+
+    /**
+     * pack, unpack, get, sum and select agree with the plain values.
+     */
+    template< typename Q, unsigned Bits >
+    bool round_trip( std::size_t const n )
+    {
+        std::vector<Q> const v = sample<Q>( n, Bits );
+        wv::packed_array<Q, Bits> const a( wv::make_span( v ) );
+
+        std::vector<Q> out( n );
+        wv::unpack( a, wv::make_span( out ) );
+
+        bool same = a.size() == n && out == v;
+        uint64_t total = 0;
+        std::size_t below = 0;
+        Q const limit( typename Q::value_type( wv::packed_array<Q, Bits>::max_value / 3 ) );
+
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            same = same && a[i] == v[i];
+            total += v[i].value();
+            below += v[i] < limit;
+        }
+
+        wv::mask<Rows> const m = wv::select_less<Rows>( a, limit );
+        for ( std::size_t i = 0; i < n; ++i )
+            same = same && m[i] == ( v[i] < limit );
+
+        return same && uint64_t( wv::sum( a ).value() ) == total && m.count() == below;
+    }
+
+} // namespace
+
+TEST_CASE( "packed/footprint",
+           "A packed array takes Bits bits per row, in blocks of 128 rows." )
+{
+    REQUIRE( ( wv::packed_array<Code, 12>::max_value == 4095u ) );
+
+    wv::packed_array<Code, 12> const a( 1280 );
+    REQUIRE( a.size() == 1280 );
+    REQUIRE( a.bytes() == 1280 * 12 / 8 + 16 );
+
+    wv::packed_array<Code, 12> const b( 1281 );
+    REQUIRE( b.bytes() == 1408 * 12 / 8 + 16 );
+
+    REQUIRE( ( wv::packed_array<Code, 12>::fits( Code( 4095 ) ) ) );
+    REQUIRE( !( wv::packed_array<Code, 12>::fits( Code( 4096 ) ) ) );
+}
+
+TEST_CASE( "packed/access",
+           "get() and set() access single rows." )
+{
+    wv::packed_array<Code, 17> a( 300 );
+
+    for ( std::size_t i = 0; i < a.size(); ++i )
+        a.set( i, Code( uint32_t( i * 437 ) & 0x1ffff ) );
+
+    bool same = true;
+    for ( std::size_t i = 0; i < a.size(); ++i )
+        same = same && a.get( i ) == Code( uint32_t( i * 437 ) & 0x1ffff );
+    REQUIRE( same );
+
+    // overwrite a row whose bits cross a word:
+    a.set( 5, Code( 0x1ffff ) );
+    a.set( 5, Code( 1 ) );
+    REQUIRE( a[5] == Code( 1 ) );
+    REQUIRE( a[4] == Code( 4 * 437 ) );
+    REQUIRE( a[9] == Code( 9 * 437 ) );
+
+    a.resize( 130 );
+    a.resize( 300 );
+    REQUIRE( a[129] == Code( 129 * 437 ) );
+    REQUIRE( a[130] == Code( 0 ) );
+    REQUIRE( a[299] == Code( 0 ) );
+
+    wv::packed_array<Code, 3> b;
+    for ( uint32_t i = 0; i < 1000; ++i )
+        b.push_back( Code( i % 8 ) );
+    REQUIRE( b.size() == 1000 );
+    REQUIRE( b[999] == Code( 7 ) );
+    REQUIRE( b[500] == Code( 4 ) );
+}
+
+TEST_CASE( "packed/bulk",
+           "unpack(), pack(), sum() and select agree with the plain values for every width." )
+{
+    REQUIRE( ( round_trip<Code, 1>( 1000 ) ) );
+    REQUIRE( ( round_trip<Code, 5>( 128 ) ) );
+    REQUIRE( ( round_trip<Code, 10>( 1001 ) ) );
+    REQUIRE( ( round_trip<Code, 12>( 64 ) ) );
+    REQUIRE( ( round_trip<Code, 13>( 129 ) ) );
+    REQUIRE( ( round_trip<Code, 16>( 5000 ) ) );
+    REQUIRE( ( round_trip<Code, 20>( 1001 ) ) );
+    REQUIRE( ( round_trip<Code, 31>( 777 ) ) );
+    REQUIRE( ( round_trip<Code, 32>( 1001 ) ) );
+    REQUIRE( ( round_trip<Small, 11>( 1001 ) ) );
+    REQUIRE( ( round_trip<Wide, 27>( 1001 ) ) );
+    REQUIRE( ( round_trip<Code, 7>( 0 ) ) );
+
+    std::vector<Code> const v = sample<Code>( 1001, 14 );
+    wv::packed_array<Code, 14> a;
+    wv::pack( wv::make_span( v ), a );
+    REQUIRE( a == wv::packed_array<Code, 14>( wv::make_span( v ) ) );
+
+    REQUIRE( ( std::is_same< decltype( wv::sum( a ) ), wv::arithmetic<uint64_t, Code_tag> >::value ) );
+
+    wv::mask<Rows> const m = wv::select_greater_equal<Rows>( a, Code( 100 ) ) & wv::select_not_equal<Rows>( a, Code( 200 ) );
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < v.size(); ++i )
+        count += v[i] >= Code( 100 ) && v[i] != Code( 200 );
+    REQUIRE( m.count() == count );
+}
+
+/*
+ * end of file
+ */
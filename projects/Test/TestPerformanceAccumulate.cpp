@@ -0,0 +1,89 @@
+/*
+ * TestPerformanceAccumulate.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compare wv::sum over narrow columns (int32_t, float) with a hand-written
+ * loop that unwraps into int64_t or double, and with summing a column that
+ * is stored wide.
+ *
+ * Usage: TestPerformanceAccumulate [elements]
+ */
+
+#include "whole_value_accumulate.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Volume, int32_t )
+WV_DEFINE_ARITHMETIC_TYPE( Weight, float )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+template< typename Q >
+void report( char const * const name, std::vector<Q> const & v )
+{
+    typedef typename wv::accumulator<Q>::type W;
+    typedef typename W::value_type T;
+
+    std::size_t const n = v.size();
+
+    Clock::time_point t0 = Clock::now();
+    T s1 = 0;
+    for ( std::size_t i = 0; i < n; ++i )
+        s1 += T( v[i].value() );
+    double const t_loop = ns_per( t0, n );
+
+    t0 = Clock::now();
+    W const s2 = wv::sum( wv::make_span( v ) );
+    double const t_sum = ns_per( t0, n );
+
+    std::vector<W> wide( n );
+    wv::widen( wv::make_span( v ), wv::make_span( wide ) );
+
+    t0 = Clock::now();
+    W const s3 = wv::sum( wv::make_span( wide ) );
+    double const t_wide = ns_per( t0, n );
+
+    std::cout << name << "\t" << t_loop << "\t" << t_sum << "\t" << t_wide << "\t" << s1 << "\t" << s2.value() << "\t" << s3.value() << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 20000000;
+
+    std::cout << "Performance test of whole_value widening accumulators: " << n << " elements." << std::endl;
+
+    std::vector<Volume> volume( n );
+    std::vector<Weight> weight( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        volume[i] = Volume( int32_t( i % 1000 ) * 1000000 );
+        weight[i] = Weight( float( i % 1000 ) / 7 );
+    }
+
+    std::cout << "         unwrap loop  wv::sum narrow  wv::sum wide  (ns/element)  sums" << std::endl;
+
+    report( "int32_t:", volume );
+    report( "float:", weight );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
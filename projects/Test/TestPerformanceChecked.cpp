@@ -0,0 +1,113 @@
+/*
+ * TestPerformanceChecked.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Overhead of checked arithmetic: element-wise add and multiply-accumulate
+ * over int32_t and int64_t columns with quantity and arithmetic types, and
+ * with their checked counterparts under the throw and sticky policies.
+ *
+ * Usage: TestPerformanceChecked [elements]
+ */
+
+#include "whole_value_checked.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Volume, int32_t )
+WV_DEFINE_CHECKED_QUANTITY_TYPE( CVolume, int32_t, ::wv::throw_on_overflow )
+WV_DEFINE_CHECKED_QUANTITY_TYPE( SVolume, int32_t, ::wv::sticky_overflow )
+
+WV_DEFINE_ARITHMETIC_TYPE( Count, int64_t )
+WV_DEFINE_CHECKED_ARITHMETIC_TYPE( CCount, int64_t, ::wv::throw_on_overflow )
+WV_DEFINE_CHECKED_ARITHMETIC_TYPE( SCount, int64_t, ::wv::sticky_overflow )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+/**
+ * c[i] = a[i] + b[i] + a[i].
+ */
+template< typename Q >
+double add( std::size_t const n, int64_t & check )
+{
+    std::vector<Q> a( n ), b( n ), c( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        a[i] = Q( typename Q::value_type( i % 1000 ) );
+        b[i] = Q( typename Q::value_type( i % 777 ) );
+    }
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        c[i] = a[i] + b[i] + a[i];
+    double const t = ns_per( t0, n );
+
+    check = c[ n / 2 ].value();
+    return t;
+}
+
+/**
+ * s = s * 3 + a[i] (the multiplier is a Q for arithmetic).
+ */
+template< typename Q >
+double mac( std::size_t const n, int64_t & check )
+{
+    std::vector<Q> a( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        a[i] = Q( typename Q::value_type( i % 1000 ) );
+
+    Q s( 0 );
+    Q const three( 3 );
+    Q const mod( 1000003 );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        s = ( s * three + a[i] ) % mod;
+    double const t = ns_per( t0, n );
+
+    check = s.value();
+    return t;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    std::cout << "Performance test of whole_value checked arithmetic: " << n << " elements." << std::endl;
+    std::cout << "                       unchecked  checked-throw  checked-sticky  (ns/element)" << std::endl;
+
+    int64_t c1 = 0, c2 = 0, c3 = 0;
+
+    double const a1 = add<Volume>( n, c1 );
+    double const a2 = add<CVolume>( n, c2 );
+    double const a3 = add<SVolume>( n, c3 );
+    std::cout << "add quantity<int32_t>:\t" << a1 << "\t" << a2 << "\t" << a3 << ( c1 == c2 && c1 == c3 ? "" : "\t(mismatch)" ) << std::endl;
+
+    double const m1 = mac<Count>( n, c1 );
+    double const m2 = mac<CCount>( n, c2 );
+    double const m3 = mac<SCount>( n, c3 );
+    std::cout << "mac arithmetic<int64_t>:\t" << m1 << "\t" << m2 << "\t" << m3 << ( c1 == c2 && c1 == c3 ? "" : "\t(mismatch)" ) << std::endl;
+
+    std::cout << "overflow flag: " << wv::sticky_overflow::test() << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,120 @@
+/*
+ * TestPerformanceColumn.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compare std::vector<Quant> (serial initialization, regular pages) with
+ * wv::column<Quant> (parallel first-touch, transparent huge pages) for a
+ * sequential scan and a random gather.
+ *
+ * Usage: TestPerformanceColumn [elements [threads]]
+ */
+
+#include "whole_value_column.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+
+typedef std::chrono::steady_clock Clock;
+
+double seconds_since( Clock::time_point const t0 )
+{
+    return std::chrono::duration<double>( Clock::now() - t0 ).count();
+}
+
+template< typename C >
+double scan( C const & c, unsigned const threads, double & result )
+{
+    std::vector<double> sums( threads, 0.0 );
+
+    Clock::time_point const t0 = Clock::now();
+
+    wv::parallel_for( 0, c.size(), threads, [&c, &sums]( std::size_t first, std::size_t last, unsigned t )
+    {
+        double s = 0;
+        for ( std::size_t i = first; i < last; ++i )
+            s += c[i].value();
+        sums[t] = s;
+    }, WV_HUGE_PAGE_SIZE / sizeof( Quant ) );
+
+    double const dt = seconds_since( t0 );
+
+    for ( unsigned t = 0; t < threads; ++t )
+        result += sums[t];
+
+    return dt;
+}
+
+template< typename C >
+double gather( C const & c, std::vector<std::size_t> const & index, unsigned const threads, double & result )
+{
+    std::vector<double> sums( threads, 0.0 );
+
+    Clock::time_point const t0 = Clock::now();
+
+    wv::parallel_for( 0, index.size(), threads, [&c, &index, &sums]( std::size_t first, std::size_t last, unsigned t )
+    {
+        double s = 0;
+        for ( std::size_t i = first; i < last; ++i )
+            s += c[ index[i] ].value();
+        sums[t] = s;
+    } );
+
+    double const dt = seconds_since( t0 );
+
+    for ( unsigned t = 0; t < threads; ++t )
+        result += sums[t];
+
+    return dt;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : std::size_t( 1 ) << 25;
+    unsigned const threads = argc > 2 ? std::atoi( argv[2] ) : wv::hardware_threads();
+
+    std::cout << "Performance test of whole_value column: " << n << " elements, " << threads << " threads." << std::endl;
+
+    std::vector<std::size_t> index( n / 4 );
+    std::mt19937_64 rng( 42 );
+    for ( std::size_t i = 0; i < index.size(); ++i )
+        index[i] = rng() % n;
+
+    double result = 0;
+
+    Clock::time_point t0 = Clock::now();
+    std::vector<Quant> v( n, Quant( 1 ) );
+    double const vinit = seconds_since( t0 );
+
+    t0 = Clock::now();
+    wv::column<Quant> c( n, Quant( 1 ), threads );
+    double const cinit = seconds_since( t0 );
+
+    double const vscan   = scan( v, threads, result );
+    double const cscan   = scan( c, threads, result );
+    double const vgather = gather( v, index, threads, result );
+    double const cgather = gather( c, index, threads, result );
+
+    std::cout << "                    std::vector  wv::column  (ns/element)" << std::endl;
+    std::cout << "initialize:     " << 1e9 * vinit   / n << "\t" << 1e9 * cinit   / n << std::endl;
+    std::cout << "sequential scan:" << 1e9 * vscan   / n << "\t" << 1e9 * cscan   / n << std::endl;
+    std::cout << "random gather:  " << 1e9 * vgather / index.size() << "\t" << 1e9 * cgather / index.size() << std::endl;
+    std::cout << "(result: " << result << ")" << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
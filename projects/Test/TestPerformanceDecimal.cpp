@@ -0,0 +1,190 @@
+/*
+ * TestPerformanceDecimal.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Decimal money against double: parse and format amounts with two decimals
+ * (decimal parse() and format() against strtod() and snprintf( "%.2f" )),
+ * sum them, and apply a 21% rate with rounding to cents.
+ *
+ * Where the compiler provides the decimal floating point of TR 24733 (GCC's
+ * <decimal/decimal>), sum and rate also run on std::decimal::decimal64. It
+ * has no text conversion, so parse and format are not compared.
+ *
+ * Usage: TestPerformanceDecimal [elements]
+ */
+
+#include "whole_value_decimal.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#if defined( __DEC64_MANT_DIG__ ) && defined( __has_include )
+# if __has_include( <decimal/decimal> )
+#  include <decimal/decimal>
+#  define HAVE_DECIMAL64
+# endif
+#endif
+
+WV_DEFINE_QUANTITY_TYPE( DMoney, double )
+WV_DEFINE_DECIMAL_TYPE( Money, 2, ::wv::round_to_nearest_even )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+/**
+ * amounts as text, each terminated by '\0'.
+ */
+std::vector<char> make_text( std::size_t const n, std::vector<std::size_t> & offsets )
+{
+    std::vector<char> text;
+    offsets.resize( n );
+    char buffer[32];
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        uint64_t const cents = ( i * 2654435761u ) % 100000000;
+        int const len = std::snprintf( buffer, sizeof buffer, "%llu.%02llu", (unsigned long long)( cents / 100 ), (unsigned long long)( cents % 100 ) );
+        offsets[i] = text.size();
+        text.insert( text.end(), buffer, buffer + len + 1 );
+    }
+    return text;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 2000000;
+
+    std::cout << "Performance test of whole_value decimal: " << n << " elements." << std::endl;
+#ifdef HAVE_DECIMAL64
+    std::cout << "             double  decimal<2>  decimal64  (ns/element)" << std::endl;
+#else
+    std::cout << "             double  decimal<2>  (ns/element)  decimal64: not available" << std::endl;
+#endif
+
+    std::vector<std::size_t> offsets;
+    std::vector<char> const text = make_text( n, offsets );
+
+    std::vector<DMoney> d( n );
+    std::vector<Money> m( n );
+
+    // parse:
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        d[i] = DMoney( std::strtod( &text[ offsets[i] ], 0 ) );
+    double const p1 = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        char const * const s = &text[ offsets[i] ];
+        parse( s, s + std::strlen( s ), m[i] );
+    }
+    double const p2 = ns_per( t0, n );
+
+    std::cout << "parse:\t\t" << p1 << "\t" << p2 << std::endl;
+
+    // format:
+
+    char buffer[ Money::max_chars ];
+    std::size_t chars1 = 0, chars2 = 0;
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        chars1 += std::snprintf( buffer, sizeof buffer, "%.2f", d[i].value() );
+    double const f1 = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        chars2 += format( m[i], buffer ) - buffer;
+    double const f2 = ns_per( t0, n );
+
+    std::cout << "format:\t\t" << f1 << "\t" << f2 << ( chars1 == chars2 ? "" : "\t(mismatch)" ) << std::endl;
+
+    // sum:
+
+    t0 = Clock::now();
+    DMoney dsum( 0 );
+    for ( std::size_t i = 0; i < n; ++i )
+        dsum += d[i];
+    double const s1 = ns_per( t0, n );
+
+    t0 = Clock::now();
+    Money msum;
+    for ( std::size_t i = 0; i < n; ++i )
+        msum += m[i];
+    double const s2 = ns_per( t0, n );
+
+#ifdef HAVE_DECIMAL64
+    using std::decimal::decimal64;
+
+    std::vector<decimal64> x( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        x[i] = std::decimal::make_decimal64( (long long)( m[i].value() ), -2 );
+
+    t0 = Clock::now();
+    decimal64 xsum( 0 );
+    for ( std::size_t i = 0; i < n; ++i )
+        xsum += x[i];
+    double const s3 = ns_per( t0, n );
+
+    std::cout << "sum:\t\t" << s1 << "\t" << s2 << "\t" << s3 << "\t(" << dsum.value() << " vs " << msum
+              << ( std::decimal::decimal64_to_long_long( xsum * decimal64( 100 ) ) == msum.value() ? "" : ", decimal64 mismatch" ) << ")" << std::endl;
+#else
+    std::cout << "sum:\t\t" << s1 << "\t" << s2 << "\t(" << dsum.value() << " vs " << msum << ")" << std::endl;
+#endif
+
+    // 21% rate, rounded to cents:
+
+    std::vector<DMoney> dr( n );
+    std::vector<Money> mr( n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        dr[i] = DMoney( std::nearbyint( d[i].value() * 21 ) / 100 );
+    double const r1 = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        mr[i] = scale( m[i], 21, 100 );
+    double const r2 = ns_per( t0, n );
+
+#ifdef HAVE_DECIMAL64
+    // decimal64 has no quantize(): round to cents through an integer, halves up as the amounts are positive:
+    std::vector<decimal64> xr( n );
+    decimal64 const rate = std::decimal::make_decimal64( 21ll, -2 ), half( std::decimal::make_decimal64( 5ll, -1 ) );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        xr[i] = std::decimal::make_decimal64( std::decimal::decimal64_to_long_long( x[i] * rate * decimal64( 100 ) + half ), -2 );
+    double const r3 = ns_per( t0, n );
+
+    std::cout << "rate:\t\t" << r1 << "\t" << r2 << "\t" << r3 << "\t(" << dr[ n / 2 ].value() << " vs " << mr[ n / 2 ]
+              << " vs " << std::decimal::decimal64_to_long_long( xr[ n / 2 ] * decimal64( 100 ) ) << " cents)" << std::endl;
+#else
+    std::cout << "rate:\t\t" << r1 << "\t" << r2 << "\t(" << dr[ n / 2 ].value() << " vs " << mr[ n / 2 ] << ")" << std::endl;
+#endif
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
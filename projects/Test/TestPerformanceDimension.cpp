@@ -0,0 +1,164 @@
+/*
+ * TestPerformanceDimension.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Dimensioned quantities against raw double: kinetic energy and braking
+ * distance of a column of masses and speeds, and a chain of products of
+ * 200 quantities that each have a different dimension of seven exponents,
+ * which makes the compiler instantiate some 400 dimensions and operators.
+ *
+ * The run times should be equal. For the build time, compare the time to
+ * compile this file with the time to compile it with -DWV_NO_DIMENSION_CHAIN.
+ *
+ * Usage: TestPerformanceDimension [elements]
+ */
+
+#include "whole_value_dimension.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// exponents of length, mass, time:
+WV_DEFINE_DIMENSION_TYPE( Distance, double, 1 )
+WV_DEFINE_DIMENSION_TYPE( Mass, double, 0, 1 )
+WV_DEFINE_DIMENSION_TYPE( Speed, double, 1, 0, -1 )
+WV_DEFINE_DIMENSION_TYPE( Acceleration, double, 1, 0, -2 )
+WV_DEFINE_DIMENSION_TYPE( Energy, double, 2, 1, -2 )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+#ifndef WV_NO_DIMENSION_CHAIN
+/**
+ * product of x[0] ... x[I], each in a dimension of its own.
+ */
+template< int I >
+struct chain
+{
+    typedef wv::quantity< double, wv::make_dimension< I % 5 - 2, I / 5 % 5 - 2, I / 25 % 5 - 2, I % 3 - 1, I % 7 - 3, I % 2, I / 100 > > Q;
+    typedef decltype( std::declval<Q>() * std::declval< typename chain< I - 1 >::result >() ) result;
+
+    static result product( double const * const x )
+    {
+        return Q( x[I] ) * chain< I - 1 >::product( x );
+    }
+};
+
+template<>
+struct chain< 0 >
+{
+    typedef wv::quantity< double, wv::make_dimension< -2, -2, -2, -1, -3 > > result;
+
+    static result product( double const * const x )
+    {
+        return result( x[0] );
+    }
+};
+
+/**
+ * the value of a quantity or a number.
+ */
+inline double value_of( double const x ) { return x; }
+
+template< typename T, typename D >
+double value_of( wv::quantity<T, D> const & x ) { return x.value(); }
+#endif
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    std::cout << "Performance test of whole_value dimension: " << n << " elements." << std::endl;
+    std::cout << "                   double  dimension  (ns/element)" << std::endl;
+
+    std::vector<double> m( n ), v( n ), e( n ), s( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        m[i] = 1000.0 + double( i % 1000 );
+        v[i] = double( i % 50 );
+    }
+    double const a = 7.5 + 0.1 * ( argc - 1 );
+
+    // kinetic energy m v^2 / 2 and braking distance v^2 / 2a:
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        e[i] = m[i] * v[i] * v[i] / 2.0;
+        s[i] = v[i] * v[i] / ( 2.0 * a );
+    }
+    double const r1 = ns_per( t0, n );
+    double const c1 = e[ n / 2 ] + s[ n / 3 ];
+
+    std::vector<Mass> qm( m.begin(), m.end() );
+    std::vector<Speed> qv( v.begin(), v.end() );
+    std::vector<Energy> qe( n );
+    std::vector<Distance> qs( n );
+    Acceleration const qa( a );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        qe[i] = qm[i] * qv[i] * qv[i] / 2.0;
+        qs[i] = qv[i] * qv[i] / ( 2.0 * qa );
+    }
+    double const r2 = ns_per( t0, n );
+    double const c2 = qe[ n / 2 ].value() + qs[ n / 3 ].value();
+
+    std::cout << "energy, distance:\t" << r1 << "\t" << r2 << ( c1 == c2 ? "" : "\t(mismatch)" ) << std::endl;
+
+#ifndef WV_NO_DIMENSION_CHAIN
+    // product of 200 factors close to 1:
+
+    std::size_t const rounds = n / 200 + 1;
+    std::vector<double> x0( 200 );
+    for ( int i = 0; i < 200; ++i )
+        x0[i] = 1.0 + ( i % 7 ) * 1e-3 * argc;
+
+    std::vector<double> x( x0 );
+
+    double p1 = 0;
+    t0 = Clock::now();
+    for ( std::size_t k = 0; k < rounds; ++k )
+    {
+        double p = x[0];
+        for ( int i = 1; i < 200; ++i )
+            p = x[i] * p;
+        p1 += p;
+        x[ k % 200 ] += 1e-12;
+    }
+    double const t1 = ns_per( t0, rounds * 200 );
+
+    x = x0;
+    double p2 = 0;
+    t0 = Clock::now();
+    for ( std::size_t k = 0; k < rounds; ++k )
+    {
+        p2 += value_of( chain< 199 >::product( &x[0] ) );
+        x[ k % 200 ] += 1e-12;
+    }
+    double const t2 = ns_per( t0, rounds * 200 );
+
+    std::cout << "chain of 200:\t\t" << t1 << "\t" << t2 << ( p1 == p2 ? "" : "\t(mismatch)" ) << std::endl;
+#endif
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
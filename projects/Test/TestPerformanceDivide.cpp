@@ -0,0 +1,128 @@
+/*
+ * TestPerformanceDivide.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Division by a run-time divisor: bucket a column of timestamps into
+ * intervals with quantity / value_type (a divide instruction per element),
+ * with quantity / divisor, and with divide() and remainder() on the column.
+ *
+ * Usage: TestPerformanceDivide [elements]
+ */
+
+#include "whole_value_divide.h"
+#include "TestRandom.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Nanos, int64_t )
+WV_DEFINE_QUANTITY_TYPE( Micros, uint32_t )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+template< typename Q >
+std::vector<Q> timestamps( std::size_t const n )
+{
+    std::vector<Q> t( n );
+    xorshift64 next;
+    uint64_t now = 1700000000000000000ull;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        now += next() % 100000;
+        t[i] = Q( typename Q::value_type( now ) );
+    }
+    return t;
+}
+
+template< typename Q >
+uint64_t check( std::vector<Q> const & v )
+{
+    return uint64_t( v[ v.size() / 2 ].value() ) + uint64_t( v[ v.size() / 3 ].value() );
+}
+
+/**
+ * quotients by /, by divisor and by divide(), and remainders by % and remainder().
+ */
+template< typename Q >
+void run( char const * const name, std::vector<Q> const & t, typename Q::value_type const interval )
+{
+    typedef typename Q::value_type T;
+
+    std::size_t const n = t.size();
+    std::vector<Q> out( n );
+    wv::divisor<T> const d( interval );
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        out[i] = t[i] / interval;
+    double const q1 = ns_per( t0, n );
+    uint64_t const c1 = check( out );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        out[i] = t[i] / d;
+    double const q2 = ns_per( t0, n );
+    uint64_t const c2 = check( out );
+
+    t0 = Clock::now();
+    divide( wv::make_span( t ), d, wv::make_span( out ) );
+    double const q3 = ns_per( t0, n );
+    uint64_t const c3 = check( out );
+
+    std::cout << name << " /:\t" << q1 << "\t" << q2 << "\t\t" << q3 << ( c1 == c2 && c1 == c3 ? "" : "\t(mismatch)" ) << std::endl;
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        out[i] = t[i] % interval;
+    double const r1 = ns_per( t0, n );
+    uint64_t const d1 = check( out );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        out[i] = t[i] % d;
+    double const r2 = ns_per( t0, n );
+    uint64_t const d2 = check( out );
+
+    t0 = Clock::now();
+    remainder( wv::make_span( t ), d, wv::make_span( out ) );
+    double const r3 = ns_per( t0, n );
+    uint64_t const d3 = check( out );
+
+    std::cout << name << " %:\t" << r1 << "\t" << r2 << "\t\t" << r3 << ( d1 == d2 && d1 == d3 ? "" : "\t(mismatch)" ) << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    // run-time intervals the compiler cannot see:
+    int64_t const second = 1000000000 + ( argc - 1 );
+    uint32_t const millisecond = 1000u + uint32_t( argc - 1 );
+
+    std::cout << "Performance test of whole_value divide: " << n << " elements." << std::endl;
+    std::cout << "                  native  divisor  divide()  (ns/element)" << std::endl;
+
+    run( "int64_t ", timestamps<Nanos>( n ), second );
+    run( "uint32_t", timestamps<Micros>( n ), millisecond );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,108 @@
+/*
+ * TestPerformanceFilter.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compare a scalar two-predicate filter with std::copy_if to mask kernels
+ * combined with & and followed by compaction, at several selectivities.
+ *
+ * Usage: TestPerformanceFilter [rows]
+ */
+
+#include "whole_value_filter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+WV_DEFINE_ARITHMETIC_TYPE( Count, int32_t )
+
+struct Orders {};
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+void report( std::vector<Price> const & price, std::vector<Count> const & count, double const limit )
+{
+    std::size_t const n = price.size();
+
+    // scalar: one pass, both predicates, push the selected prices:
+    Clock::time_point t0 = Clock::now();
+    std::vector<Price> a;
+    for ( std::size_t i = 0; i < n; ++i )
+        if ( price[i].value() < limit && count[i].value() >= 10 )
+            a.push_back( price[i] );
+    double const t_scalar = ns_per( t0, n );
+
+    // std::copy_if on a single predicate, for reference:
+    t0 = Clock::now();
+    std::vector<Price> b;
+    std::copy_if( price.begin(), price.end(), std::back_inserter( b ), [=]( Price const & x ) { return x.value() < limit; } );
+    double const t_copy_if = ns_per( t0, n );
+
+    // masks:
+    t0 = Clock::now();
+    wv::mask<Orders> const m =
+        wv::select_less<Orders>( wv::make_span( price ), Price( limit ) )
+        & wv::select_greater_equal<Orders>( wv::make_span( count ), Count( 10 ) );
+    double const t_mask = ns_per( t0, n );
+
+    t0 = Clock::now();
+    std::vector<Price> const c = wv::compact( price, m );
+    double const t_compact = ns_per( t0, n );
+
+    t0 = Clock::now();
+    std::vector<uint32_t> const rows = wv::compact_indices<uint32_t>( m );
+    double const t_indices = ns_per( t0, n );
+
+    bool const same = a.size() == c.size() && rows.size() == c.size() && ( c.empty() || a.back().value() == c.back().value() );
+
+    std::cout << 100.0 * c.size() / n << "%\t" << t_scalar << "\t" << t_copy_if << "\t" << t_mask << "\t" << t_compact << "\t" << t_indices
+              << ( same ? "" : "\t(mismatch)" ) << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    std::cout << "Performance test of whole_value filter: " << n << " rows." << std::endl;
+
+    std::mt19937 rng( 42 );
+    std::uniform_real_distribution<double> dist( 0, 100 );
+
+    std::vector<Price> price( n );
+    std::vector<Count> count( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        price[i] = Price( dist( rng ) );
+        count[i] = Count( int32_t( rng() % 100 ) );
+    }
+
+    std::cout << "selected  scalar  copy_if(1 pred)  mask(2 preds)  compact  indices  (ns/row)" << std::endl;
+
+    double const limits[] = { 1, 10, 50, 90, 100 };
+    for ( std::size_t l = 0; l < sizeof limits / sizeof limits[0]; ++l )
+        report( price, count, limits[l] );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
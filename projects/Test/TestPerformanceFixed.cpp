@@ -0,0 +1,138 @@
+/*
+ * TestPerformanceFixed.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Fixed point against double: accumulate prices and count those above a
+ * limit with quantity<double> and fixed<int64_t, 16>, and scale a column
+ * of prices by a factor with these and with fixed<int32_t, 8>, which has
+ * half the footprint (but too small a range for the sum).
+ *
+ * Usage: TestPerformanceFixed [elements]
+ */
+
+#include "whole_value_fixed.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+WV_DEFINE_FIXED_TYPE( FPrice, int64_t, 16, ::wv::round_to_nearest )
+WV_DEFINE_FIXED_TYPE( FPrice32, int32_t, 8, ::wv::round_to_nearest )
+WV_DEFINE_FIXED_TYPE( Factor, int32_t, 16, ::wv::round_to_nearest )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+double price_of( std::size_t const i )
+{
+    return double( ( i * 2654435761u ) % 100000 ) / 256;
+}
+
+template< typename Q > Q make( double x );
+template<> Price make<Price>( double x ) { return Price( x ); }
+template<> FPrice make<FPrice>( double x ) { return FPrice::from_real( x ); }
+template<> FPrice32 make<FPrice32>( double x ) { return FPrice32::from_real( x ); }
+
+double real( Price const & x ) { return x.value(); }
+template< typename Q > double real( Q const & x ) { return to_real( x ); }
+
+/**
+ * sum of a[i], and count of a[i] > limit.
+ */
+template< typename Q >
+double accumulate( std::size_t const n, double & check )
+{
+    std::vector<Q> a( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        a[i] = make<Q>( price_of( i ) );
+
+    Q const limit = make<Q>( 200.0 );
+
+    Clock::time_point const t0 = Clock::now();
+    Q sum = Q();
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        sum += a[i];
+        count += a[i] > limit;
+    }
+    double const t = ns_per( t0, n );
+
+    check = real( sum ) + double( count );
+    return t;
+}
+
+/**
+ * c[i] = a[i] * 1.0625.
+ */
+double scale_double( std::size_t const n, double & check )
+{
+    std::vector<Price> a( n ), c( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        a[i] = Price( price_of( i ) );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        c[i] = Price( a[i].value() * 1.0625 );
+    double const t = ns_per( t0, n );
+
+    check = c[ n / 2 ].value();
+    return t;
+}
+
+template< typename Q >
+double scale_fixed( std::size_t const n, double & check )
+{
+    std::vector<Q> a( n ), c( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        a[i] = make<Q>( price_of( i ) );
+
+    Factor const f = Factor::from_real( 1.0625 );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        c[i] = scale( a[i], f );
+    double const t = ns_per( t0, n );
+
+    check = to_real( c[ n / 2 ] );
+    return t;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    std::cout << "Performance test of whole_value fixed point: " << n << " elements." << std::endl;
+    std::cout << "                     double  fixed<int64_t,16>  fixed<int32_t,8>  (ns/element)" << std::endl;
+
+    double c1 = 0, c2 = 0, c3 = 0;
+
+    double const a1 = accumulate<Price>( n, c1 );
+    double const a2 = accumulate<FPrice>( n, c2 );
+    std::cout << "accumulate-compare:\t" << a1 << "\t" << a2 << "\t-" << ( c1 == c2 ? "" : "\t(mismatch)" ) << std::endl;
+
+    double const s1 = scale_double( n, c1 );
+    double const s2 = scale_fixed<FPrice>( n, c2 );
+    double const s3 = scale_fixed<FPrice32>( n, c3 );
+    std::cout << "scale:\t\t\t" << s1 << "\t" << s2 << "\t" << s3 << ( c1 == c2 ? "" : "\t(mismatch)" ) << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,125 @@
+/*
+ * TestPerformanceHash.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compare insertion and lookup of wv::flat_map<OrderId, Price> with
+ * std::unordered_map, keyed by raw uint64_t (identity hash) and by OrderId
+ * (std::hash specialization from whole_value_hash.h).
+ *
+ * Usage: TestPerformanceHash [keys]
+ */
+
+#include "whole_value_flat_map.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+WV_DEFINE_VALUE_TYPE( OrderId, uint64_t )
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+struct result
+{
+    double insert, hit, miss;
+};
+
+template< typename Map, typename Key >
+result run_std( std::vector<uint64_t> const & keys, std::vector<uint64_t> const & probes, double & sum )
+{
+    result r;
+    Map m;
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+        m.insert( std::make_pair( Key( keys[i] ), Price( 1 ) ) );
+    r.insert = ns_per( t0, keys.size() );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < probes.size(); ++i )
+        sum += m.find( Key( keys[ probes[i] ] ) )->second.value();
+    r.hit = ns_per( t0, probes.size() );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < probes.size(); ++i )
+        sum += m.count( Key( keys[ probes[i] ] + 1 ) );
+    r.miss = ns_per( t0, probes.size() );
+
+    return r;
+}
+
+result run_flat( std::vector<uint64_t> const & keys, std::vector<uint64_t> const & probes, double & sum )
+{
+    result r;
+    wv::flat_map<OrderId, Price> m;
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+        m.insert( OrderId( keys[i] ), Price( 1 ) );
+    r.insert = ns_per( t0, keys.size() );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < probes.size(); ++i )
+        sum += m.find( OrderId( keys[ probes[i] ] ) )->value();
+    r.hit = ns_per( t0, probes.size() );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < probes.size(); ++i )
+        sum += m.contains( OrderId( keys[ probes[i] ] + 1 ) );
+    r.miss = ns_per( t0, probes.size() );
+
+    return r;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 1000000;
+
+    std::cout << "Performance test of whole_value hashing: " << n << " keys." << std::endl;
+
+    // ids with a stride, as handed out by a sharded id generator:
+
+    std::vector<uint64_t> keys( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        keys[i] = uint64_t( i ) * 64;
+
+    std::mt19937_64 rng( 42 );
+    std::vector<uint64_t> probes( 4 * n );
+    for ( std::size_t i = 0; i < probes.size(); ++i )
+        probes[i] = rng() % n;
+
+    double sum = 0;
+
+    result const a = run_std< std::unordered_map<uint64_t, Price>, uint64_t >( keys, probes, sum );
+    result const b = run_std< std::unordered_map<OrderId, Price>, OrderId >( keys, probes, sum );
+    result const c = run_flat( keys, probes, sum );
+
+    std::cout << "            unordered_map<uint64_t>  unordered_map<OrderId>  flat_map<OrderId>  (ns/operation)" << std::endl;
+    std::cout << "insert:     " << a.insert << "\t" << b.insert << "\t" << c.insert << std::endl;
+    std::cout << "lookup hit: " << a.hit    << "\t" << b.hit    << "\t" << c.hit    << std::endl;
+    std::cout << "lookup miss:" << a.miss   << "\t" << b.miss   << "\t" << c.miss   << std::endl;
+    std::cout << "(sum: " << sum << ")" << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,167 @@
+/*
+ * TestPerformanceModular.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Modular arithmetic against arithmetic % m: the shard of each hash in a
+ * column (a reduction per element), and a polynomial hash h = h * B + x
+ * (a dependent multiply and reduction per element), with a modulus known
+ * at compile time and one known at run time.
+ *
+ * Usage: TestPerformanceModular [elements]
+ */
+
+#include "whole_value_modular.h"
+#include "TestRandom.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_ARITHMETIC_TYPE( Count32, uint32_t )
+WV_DEFINE_ARITHMETIC_TYPE( Count64, uint64_t )
+
+WV_DEFINE_MODULAR_TYPE( Shard32, uint32_t, 0 )
+WV_DEFINE_MODULAR_TYPE( Prime32, uint32_t, 1000000007u )
+WV_DEFINE_MODULAR_TYPE( Runtime32, uint32_t, 0 )
+
+#ifdef G_WV_HAVE_INT128
+WV_DEFINE_MODULAR_TYPE( Shard64, uint64_t, 0 )
+#endif
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+template< typename T >
+std::vector<T> hashes( std::size_t const n )
+{
+    std::vector<T> h( n );
+    xorshift64 next;
+    for ( std::size_t i = 0; i < n; ++i )
+        h[i] = T( next() );
+    return h;
+}
+
+/**
+ * out[i] = h[i] % m with arithmetic.
+ */
+template< typename A >
+double shard_arithmetic( std::vector<typename A::value_type> const & h, A const m, uint64_t & check )
+{
+    std::vector<A> out( h.size() );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < h.size(); ++i )
+        out[i] = A( h[i] ) % m;
+    double const t = ns_per( t0, h.size() );
+
+    check = out[ h.size() / 2 ].value() + out[ h.size() / 3 ].value();
+    return t;
+}
+
+/**
+ * out[i] = Q( h[i] ).
+ */
+template< typename Q >
+double shard_modular( std::vector<typename Q::value_type> const & h, uint64_t & check )
+{
+    std::vector<Q> out( h.size() );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < h.size(); ++i )
+        out[i] = Q( h[i] );
+    double const t = ns_per( t0, h.size() );
+
+    check = out[ h.size() / 2 ].value() + out[ h.size() / 3 ].value();
+    return t;
+}
+
+/**
+ * h = ( h * B + x ) % m with arithmetic<uint64_t> on 32-bit residues.
+ */
+double poly_arithmetic( std::vector<uint32_t> const & x, Count64 const m, uint64_t & check )
+{
+    Count64 h( 0 );
+    Count64 const b( 131 );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < x.size(); ++i )
+        h = ( h * b + Count64( x[i] ) ) % m;
+    double const t = ns_per( t0, x.size() );
+
+    check = h.value();
+    return t;
+}
+
+template< typename Q >
+double poly_modular( std::vector<uint32_t> const & x, uint64_t & check )
+{
+    Q h( 0 );
+    Q const b( 131 );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < x.size(); ++i )
+        h = h * b + Q( x[i] );
+    double const t = ns_per( t0, x.size() );
+
+    check = h.value();
+    return t;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    // a run-time modulus the compiler cannot see:
+    uint32_t const shards = uint32_t( 1000 + argc );
+    uint32_t const prime = 1000000007u + uint32_t( argc - 1 );
+
+    Shard32::set_modulus( shards );
+    Runtime32::set_modulus( prime );
+
+    std::cout << "Performance test of whole_value modular: " << n << " elements." << std::endl;
+    std::cout << "                       arithmetic % m  modular  (ns/element)" << std::endl;
+
+    uint64_t c1 = 0, c2 = 0;
+
+    std::vector<uint32_t> const h32 = hashes<uint32_t>( n );
+
+    double const s1 = shard_arithmetic( h32, Count32( shards ), c1 );
+    double const s2 = shard_modular<Shard32>( h32, c2 );
+    std::cout << "shard uint32_t:\t\t" << s1 << "\t" << s2 << ( c1 == c2 ? "" : "\t(mismatch)" ) << std::endl;
+
+#ifdef G_WV_HAVE_INT128
+    Shard64::set_modulus( shards );
+    std::vector<uint64_t> const h64 = hashes<uint64_t>( n );
+
+    double const t1 = shard_arithmetic( h64, Count64( shards ), c1 );
+    double const t2 = shard_modular<Shard64>( h64, c2 );
+    std::cout << "shard uint64_t:\t\t" << t1 << "\t" << t2 << ( c1 == c2 ? "" : "\t(mismatch)" ) << std::endl;
+#endif
+
+    double const p1 = poly_arithmetic( h32, Count64( 1000000007u ), c1 );
+    double const p2 = poly_modular<Prime32>( h32, c2 );
+    std::cout << "poly, constant m:\t" << p1 << "\t" << p2 << ( c1 == c2 ? "" : "\t(mismatch)" ) << std::endl;
+
+    double const q1 = poly_arithmetic( h32, Count64( prime ), c1 );
+    double const q2 = poly_modular<Runtime32>( h32, c2 );
+    std::cout << "poly, run-time m:\t" << q1 << "\t" << q2 << ( c1 == c2 ? "" : "\t(mismatch)" ) << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
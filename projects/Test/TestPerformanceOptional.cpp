@@ -0,0 +1,139 @@
+/*
+ * TestPerformanceOptional.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Sparse columns of optional prices: footprint, and the time to count the
+ * values, to sum them and to fill the gaps, with a value and flag per
+ * element (the layout of std::optional<double>) and with optional<Price>,
+ * at several densities.
+ *
+ * Usage: TestPerformanceOptional [rows]
+ */
+
+#include "whole_value_optional.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+
+typedef wv::optional<Price> OptionalPrice;
+
+/**
+ * value and flag, as std::optional<Price>.
+ */
+struct FlaggedPrice
+{
+    FlaggedPrice() : price(), engaged( false ) {}
+    FlaggedPrice( Price const x ) : price( x ), engaged( true ) {}
+
+    bool has_value() const { return engaged; }
+    Price value_or( Price const & other ) const { return engaged ? price : other; }
+
+    Price price;
+    bool engaged;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+/**
+ * count, sum and fill with a loop per element.
+ */
+template< typename O >
+void run( char const * const name, std::vector<O> const & a )
+{
+    std::size_t const n = a.size();
+
+    Clock::time_point t0 = Clock::now();
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < n; ++i )
+        count += a[i].has_value();
+    double const t_count = ns_per( t0, n );
+
+    t0 = Clock::now();
+    double sum = 0;
+    for ( std::size_t i = 0; i < n; ++i )
+        sum += a[i].value_or( Price( 0 ) ).value();
+    double const t_sum = ns_per( t0, n );
+
+    std::vector<Price> out( n );
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        out[i] = a[i].value_or( Price( -1 ) );
+    double const t_fill = ns_per( t0, n );
+
+    std::cout << name << "\t" << sizeof( O ) * n / 1048576.0 << "\t" << t_count << "\t" << t_sum << "\t" << t_fill << "\t(" << count << ", " << sum << ", " << out[ n / 2 ].value() << ")" << std::endl;
+}
+
+/**
+ * count and fill with the bulk functions.
+ */
+void run_bulk( std::vector<OptionalPrice> const & a )
+{
+    std::size_t const n = a.size();
+
+    Clock::time_point t0 = Clock::now();
+    std::size_t const count = wv::count_values( wv::make_span( a ) );
+    double const t_count = ns_per( t0, n );
+
+    std::vector<Price> out( n );
+    t0 = Clock::now();
+    wv::value_or( wv::make_span( a ), Price( -1 ), wv::make_span( out ) );
+    double const t_fill = ns_per( t0, n );
+
+    std::cout << "bulk    \t\t" << t_count << "\t\t" << t_fill << "\t(" << count << ", " << out[ n / 2 ].value() << ")" << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    std::cout << "Performance test of whole_value optional: " << n << " rows." << std::endl;
+    std::cout << "          MiB     count   sum     fill    (ns/row)" << std::endl;
+
+    double const densities[] = { 0.01, 0.1, 0.5 };
+
+    for ( double const density : densities )
+    {
+        std::mt19937 rng( 42 );
+        std::uniform_real_distribution<double> u( 0, 1 );
+
+        std::vector<FlaggedPrice> flagged( n );
+        std::vector<OptionalPrice> sentinel( n );
+        for ( std::size_t i = 0; i < n; ++i )
+        {
+            if ( u( rng ) < density )
+            {
+                Price const x( 100 * u( rng ) );
+                flagged[i] = x;
+                sentinel[i] = x;
+            }
+        }
+
+        std::cout << std::endl << 100 * density << "% values:" << std::endl;
+        run( "flagged ", flagged );
+        run( "sentinel", sentinel );
+        run_bulk( sentinel );
+    }
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,119 @@
+/*
+ * TestPerformancePacked.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Columns of narrow codes in a std::vector<Code> and in packed_array<Code,
+ * Bits>: footprint, sum() and select_less() on either, unpack() and pack(),
+ * and random get(), for several widths.
+ *
+ * Usage: TestPerformancePacked [rows]
+ */
+
+#include "whole_value_packed.h"
+#include "TestRandom.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_ARITHMETIC_TYPE( Code, uint32_t )
+
+struct Rows {};
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+std::vector<Code> codes( std::size_t const n, unsigned const bits )
+{
+    xorshift64 next;
+    std::vector<Code> v( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v[i] = Code( uint32_t( next() ) & ( ( uint32_t( 1 ) << bits ) - 1 ) );
+    return v;
+}
+
+template< unsigned Bits >
+void run( std::size_t const n )
+{
+    std::vector<Code> const v = codes( n, Bits );
+    Code const limit( wv::packed_array<Code, Bits>::max_value / 4 );
+
+    wv::packed_array<Code, Bits> a( wv::make_span( v ) );
+
+    // again, into the allocated array:
+    Clock::time_point t0 = Clock::now();
+    wv::pack( wv::make_span( v ), a );
+    double const t_pack = ns_per( t0, n );
+
+    std::vector<Code> out( n );
+    t0 = Clock::now();
+    wv::unpack( a, wv::make_span( out ) );
+    double const t_unpack = ns_per( t0, n );
+
+    t0 = Clock::now();
+    uint64_t const s1 = wv::sum( wv::make_span( v ) ).value();
+    double const t_sum1 = ns_per( t0, n );
+
+    t0 = Clock::now();
+    uint64_t const s2 = wv::sum( a ).value();
+    double const t_sum2 = ns_per( t0, n );
+
+    t0 = Clock::now();
+    std::size_t const c1 = wv::select_less<Rows>( wv::make_span( v ), limit ).count();
+    double const t_select1 = ns_per( t0, n );
+
+    t0 = Clock::now();
+    std::size_t const c2 = wv::select_less<Rows>( a, limit ).count();
+    double const t_select2 = ns_per( t0, n );
+
+    // random rows:
+    std::size_t const m = n / 10;
+    uint64_t g1 = 0, g2 = 0;
+    t0 = Clock::now();
+    for ( std::size_t i = 0, j = 0; i < m; ++i, j = ( j + 7919 * 4099 ) % n )
+        g1 += v[j].value();
+    double const t_get1 = ns_per( t0, m );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0, j = 0; i < m; ++i, j = ( j + 7919 * 4099 ) % n )
+        g2 += a.get( j ).value();
+    double const t_get2 = ns_per( t0, m );
+
+    bool const same = out == v && s1 == s2 && c1 == c2 && g1 == g2;
+
+    std::cout << Bits << "\tvector\t" << v.size() * sizeof( Code ) / 1048576.0 << "\t" << t_sum1 << "\t" << t_select1 << "\t\t\t" << t_get1 << std::endl;
+    std::cout << "\tpacked\t" << a.bytes() / 1048576.0 << "\t" << t_sum2 << "\t" << t_select2 << "\t" << t_unpack << "\t" << t_pack << "\t" << t_get2
+              << ( same ? "" : "\t(mismatch)" ) << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 50000000;
+
+    std::cout << "Performance test of whole_value packed: " << n << " rows." << std::endl;
+    std::cout << "bits\t\tMiB\tsum\tselect\tunpack\tpack\tget  (ns/row)" << std::endl;
+
+    run<10>( n );
+    run<12>( n );
+    run<16>( n );
+    run<20>( n );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,95 @@
+/*
+ * TestPerformanceRadixSort.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compare std::sort on raw and wrapped values with wv::radix_sort, with one
+ * and with all hardware threads.
+ *
+ * Usage: TestPerformanceRadixSort [elements]
+ */
+
+#include "whole_value_radix_sort.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+WV_DEFINE_ARITHMETIC_TYPE( Int64, int64_t )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+template< typename T >
+void report( char const * const name, std::vector<typename T::value_type> const & raw )
+{
+    std::size_t const n = raw.size();
+
+    std::vector<typename T::value_type> a( raw );
+    Clock::time_point t0 = Clock::now();
+    std::sort( a.begin(), a.end() );
+    double const sort_raw = ns_per( t0, n );
+
+    std::vector<T> b( raw.begin(), raw.end() );
+    t0 = Clock::now();
+    std::sort( b.begin(), b.end() );
+    double const sort_wrapped = ns_per( t0, n );
+
+    std::vector<T> c( raw.begin(), raw.end() );
+    t0 = Clock::now();
+    wv::radix_sort( c, 1 );
+    double const radix_1 = ns_per( t0, n );
+
+    std::vector<T> d( raw.begin(), raw.end() );
+    t0 = Clock::now();
+    wv::radix_sort( d, wv::hardware_threads() );
+    double const radix_n = ns_per( t0, n );
+
+    bool const same = a.front() == c.front().value() && a.back() == d.back().value();
+
+    std::cout << name << "\t" << sort_raw << "\t" << sort_wrapped << "\t" << radix_1 << "\t" << radix_n << ( same ? "" : "\t(mismatch)" ) << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    std::cout << "Performance test of whole_value radix_sort: " << n << " elements, " << wv::hardware_threads() << " threads." << std::endl;
+
+    std::mt19937_64 rng( 42 );
+
+    std::vector<double> d( n );
+    std::uniform_real_distribution<double> dist( -1e9, 1e9 );
+    for ( std::size_t i = 0; i < n; ++i )
+        d[i] = dist( rng );
+
+    std::vector<int64_t> k( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        k[i] = int64_t( rng() );
+
+    std::cout << "            std::sort raw  std::sort wrapped  radix_sort 1 thread  radix_sort N threads  (ns/element)" << std::endl;
+
+    report<Quant>( "double:", d );
+    report<Int64>( "int64_t:", k );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
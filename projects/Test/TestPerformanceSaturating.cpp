@@ -0,0 +1,110 @@
+/*
+ * TestPerformanceSaturating.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Throughput of saturating arithmetic: element-wise c[i] = a[i] + b[i]
+ * for int16_t and int32_t quantities that wrap around, for their saturating
+ * counterparts, and for the bulk kernel saturating_add() over the wrap-around
+ * type.
+ *
+ * Usage: TestPerformanceSaturating [elements]
+ */
+
+#include "whole_value_saturating.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Sample, int16_t )
+WV_DEFINE_SATURATING_QUANTITY_TYPE( SSample, int16_t )
+
+WV_DEFINE_QUANTITY_TYPE( Volume, int32_t )
+WV_DEFINE_SATURATING_QUANTITY_TYPE( SVolume, int32_t )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+template< typename Q >
+void fill( std::vector<Q> & a, std::vector<Q> & b )
+{
+    for ( std::size_t i = 0; i < a.size(); ++i )
+    {
+        a[i] = Q( typename Q::value_type( ( i * 2654435761u ) >> 7 ) );
+        b[i] = Q( typename Q::value_type( i * 40503u ) );
+    }
+}
+
+/**
+ * c[i] = a[i] + b[i] with the operators of Q.
+ */
+template< typename Q >
+double loop( std::size_t const n, int64_t & check )
+{
+    std::vector<Q> a( n ), b( n ), c( n );
+    fill( a, b );
+
+    Clock::time_point const t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        c[i] = a[i] + b[i];
+    double const t = ns_per( t0, n );
+
+    check = c[ n / 2 ].value() + c[ n / 3 ].value();
+    return t;
+}
+
+/**
+ * the same with the bulk kernel.
+ */
+template< typename Q >
+double bulk( std::size_t const n, int64_t & check )
+{
+    std::vector<Q> a( n ), b( n ), c( n );
+    fill( a, b );
+
+    Clock::time_point const t0 = Clock::now();
+    wv::saturating_add( wv::make_span( a ), wv::make_span( b ), wv::make_span( c ) );
+    double const t = ns_per( t0, n );
+
+    check = c[ n / 2 ].value() + c[ n / 3 ].value();
+    return t;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    std::cout << "Performance test of whole_value saturating arithmetic: " << n << " elements." << std::endl;
+    std::cout << "                        wrap-around  saturating  saturating-bulk  (ns/element)" << std::endl;
+
+    int64_t c1 = 0, c2 = 0, c3 = 0;
+
+    double const s1 = loop<Sample>( n, c1 );
+    double const s2 = loop<SSample>( n, c2 );
+    double const s3 = bulk<Sample>( n, c3 );
+    std::cout << "quantity<int16_t>:\t" << s1 << "\t" << s2 << "\t" << s3 << ( c2 == c3 ? "" : "\t(mismatch)" ) << std::endl;
+
+    double const v1 = loop<Volume>( n, c1 );
+    double const v2 = loop<SVolume>( n, c2 );
+    double const v3 = bulk<Volume>( n, c3 );
+    std::cout << "quantity<int32_t>:\t" << v1 << "\t" << v2 << "\t" << v3 << ( c2 == c3 ? "" : "\t(mismatch)" ) << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,90 @@
+/*
+ * TestPerformanceScan.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Scaling of wv::reduce and wv::inclusive_scan over a quantity column from
+ * one thread to all hardware threads, against std::accumulate and
+ * std::partial_sum on the raw values.
+ *
+ * Usage: TestPerformanceScan [elements]
+ */
+
+#include "whole_value_scan.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Volume, double )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 20000000;
+
+    std::cout << "Performance test of whole_value scan: " << n << " elements, " << wv::hardware_threads() << " hardware threads." << std::endl;
+
+    std::vector<double> raw( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        raw[i] = double( i % 100 );
+
+    std::vector<Volume> v( raw.begin(), raw.end() );
+    std::vector<double> raw_out( n );
+    std::vector<Volume> out( n );
+
+    Clock::time_point t0 = Clock::now();
+    double const raw_sum = std::accumulate( raw.begin(), raw.end(), 0.0 );
+    double const t_accumulate = ns_per( t0, n );
+
+    t0 = Clock::now();
+    std::partial_sum( raw.begin(), raw.end(), raw_out.begin() );
+    double const t_partial_sum = ns_per( t0, n );
+
+    std::cout << "std::accumulate: " << t_accumulate << " ns/element, std::partial_sum: " << t_partial_sum << " ns/element" << std::endl;
+    std::cout << "threads  reduce  speed-up  inclusive_scan  speed-up  (ns/element)" << std::endl;
+
+    double reduce_1 = 0, scan_1 = 0;
+
+    for ( unsigned threads = 1; threads <= wv::hardware_threads(); threads *= 2 )
+    {
+        t0 = Clock::now();
+        Volume const sum = wv::reduce( wv::make_span( v ), Volume(), threads );
+        double const t_reduce = ns_per( t0, n );
+
+        t0 = Clock::now();
+        wv::inclusive_scan( wv::make_span( v ), wv::make_span( out ), threads );
+        double const t_scan = ns_per( t0, n );
+
+        if ( threads == 1 )
+        {
+            reduce_1 = t_reduce;
+            scan_1 = t_scan;
+        }
+
+        bool const same = sum.value() == raw_sum && out.back().value() == raw_out.back();
+
+        std::cout << threads << "\t" << t_reduce << "\t" << reduce_1 / t_reduce << "\t" << t_scan << "\t" << scan_1 / t_scan
+                  << ( same ? "" : "\t(mismatch)" ) << std::endl;
+    }
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
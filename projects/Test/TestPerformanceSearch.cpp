@@ -0,0 +1,130 @@
+/*
+ * TestPerformanceSearch.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compare the latency of std::lower_bound with the branchless, Eytzinger and
+ * linear searches, for arrays from a few elements up to sizes beyond the
+ * caches. Each search needs the result of the previous one to find its key,
+ * so searches cannot overlap and the time per search is its latency.
+ *
+ * Build at -O3: GCC vectorizes the linear search only there.
+ *
+ * Usage: TestPerformanceSearch [largest-size [searches]]
+ */
+
+#include "whole_value_search.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+
+typedef std::chrono::steady_clock Clock;
+
+volatile std::size_t g_zero = 0;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+void report( std::size_t const n, std::size_t const searches, std::mt19937_64 & rng )
+{
+    std::uniform_real_distribution<double> dist( 0, 1e6 );
+
+    std::vector<Price> v( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v[i] = Price( dist( rng ) );
+    std::sort( v.begin(), v.end() );
+
+    std::vector<Price> keys( searches );
+    for ( std::size_t i = 0; i < searches; ++i )
+        keys[i] = Price( dist( rng ) );
+
+    wv::span<Price const> const a = wv::make_span( v );
+    wv::eytzinger<Price> const tree( a );
+
+    // the key of a search is found through the previous result, masked with
+    // a zero the compiler cannot see; the results are summed, so that the
+    // searches cannot be optimized away:
+    std::size_t const zero = g_zero;
+    std::size_t check[4] = { 0, 0, 0, 0 };
+    std::size_t r = 0;
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < searches; ++i )
+    {
+        r = std::lower_bound( v.begin(), v.end(), keys[ i + ( r & zero ) ] ) - v.begin();
+        check[0] += r;
+    }
+    double const t_std = ns_per( t0, searches );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < searches; ++i )
+    {
+        r = wv::branchless_lower_bound( a, keys[ i + ( r & zero ) ] );
+        check[1] += r;
+    }
+    double const t_branchless = ns_per( t0, searches );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < searches; ++i )
+    {
+        r = tree.lower_bound( keys[ i + ( r & zero ) ] );
+        check[2] += r;
+    }
+    double const t_eytzinger = ns_per( t0, searches );
+
+    std::cout << n << "\t" << t_std << "\t" << t_branchless << "\t" << t_eytzinger;
+
+    if ( n <= 256 )
+    {
+        t0 = Clock::now();
+        for ( std::size_t i = 0; i < searches; ++i )
+        {
+            r = wv::linear_lower_bound( a, keys[ i + ( r & zero ) ] );
+            check[3] += r;
+        }
+        std::cout << "\t" << ns_per( t0, searches );
+    }
+    else
+    {
+        check[3] = check[0];
+        std::cout << "\t-";
+    }
+
+    bool const same = check[0] == check[1] && check[0] == check[2] && check[0] == check[3];
+
+    std::cout << ( same ? "" : "\t(mismatch)" ) << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const largest  = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 16 * 1024 * 1024;
+    std::size_t const searches = argc > 2 ? std::strtoul( argv[2], 0, 10 ) : 1000000;
+
+    std::cout << "Performance test of whole_value search: " << searches << " searches per size." << std::endl;
+    std::cout << "elements  std::lower_bound  branchless  eytzinger  linear  (ns/search)" << std::endl;
+
+    std::mt19937_64 rng( 42 );
+
+    for ( std::size_t n = 16; n <= largest; n *= 4 )
+        report( n, searches, rng );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
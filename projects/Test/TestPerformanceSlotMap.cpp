@@ -0,0 +1,117 @@
+/*
+ * TestPerformanceSlotMap.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Compare wv::slot_map<EntityId, Mass> with std::unordered_map<uint32_t, Mass>
+ * for insertion, random lookup, iteration and erasure.
+ *
+ * Usage: TestPerformanceSlotMap [entities]
+ */
+
+#include "whole_value_slot_map.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+WV_DEFINE_VALUE_TYPE( EntityId, uint32_t )
+WV_DEFINE_QUANTITY_TYPE( Mass, double )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 1000000;
+    std::size_t const lookups = 10 * n;
+
+    std::cout << "Performance test of whole_value slot_map: " << n << " entities." << std::endl;
+
+    std::mt19937 rng( 42 );
+    std::vector<std::size_t> order( lookups );
+    for ( std::size_t i = 0; i < lookups; ++i )
+        order[i] = rng() % n;
+
+    double sum = 0;
+
+    // slot_map:
+
+    wv::slot_map<EntityId, Mass> sm;
+    std::vector<EntityId> handles( n );
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        handles[i] = sm.insert( Mass( double( i ) ) );
+    double const sm_insert = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < lookups; ++i )
+        sum += sm.find( handles[ order[i] ] )->value();
+    double const sm_lookup = ns_per( t0, lookups );
+
+    t0 = Clock::now();
+    for ( wv::slot_map<EntityId, Mass>::const_iterator it = sm.begin(); it != sm.end(); ++it )
+        sum += it->value();
+    double const sm_iterate = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; i += 2 )
+        sm.erase( handles[i] );
+    double const sm_erase = ns_per( t0, n / 2 );
+
+    // unordered_map:
+
+    std::unordered_map<uint32_t, Mass> um;
+    std::vector<uint32_t> keys( n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        keys[i] = uint32_t( i );
+        um.insert( std::make_pair( keys[i], Mass( double( i ) ) ) );
+    }
+    double const um_insert = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < lookups; ++i )
+        sum += um.find( keys[ order[i] ] )->second.value();
+    double const um_lookup = ns_per( t0, lookups );
+
+    t0 = Clock::now();
+    for ( std::unordered_map<uint32_t, Mass>::const_iterator it = um.begin(); it != um.end(); ++it )
+        sum += it->second.value();
+    double const um_iterate = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; i += 2 )
+        um.erase( keys[i] );
+    double const um_erase = ns_per( t0, n / 2 );
+
+    std::cout << "            slot_map  unordered_map  (ns/operation)" << std::endl;
+    std::cout << "insert:     " << sm_insert  << "\t" << um_insert  << std::endl;
+    std::cout << "lookup:     " << sm_lookup  << "\t" << um_lookup  << std::endl;
+    std::cout << "iterate:    " << sm_iterate << "\t" << um_iterate << std::endl;
+    std::cout << "erase:      " << sm_erase   << "\t" << um_erase   << std::endl;
+    std::cout << "(sum: " << sum << ")" << std::endl;
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,92 @@
+/*
+ * TestPerformanceSum.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Cost of reproducible and compensated summation against a plain parallel
+ * sum, and the bits of each result per thread count: only the reproducible
+ * sum should give the same bits on every line.
+ *
+ * Usage: TestPerformanceSum [elements]
+ */
+
+#include "whole_value_scan.h"
+#include "whole_value_sum.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+WV_DEFINE_QUANTITY_TYPE( Pnl, double )
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+uint64_t bits_of( Pnl const x )
+{
+    double const d = x.value();
+    uint64_t u;
+    std::memcpy( &u, &d, sizeof u );
+    return u;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 20000000;
+
+    std::cout << "Performance test of whole_value summation: " << n << " elements, " << wv::hardware_threads() << " hardware threads." << std::endl;
+
+    std::mt19937_64 rng( 42 );
+    std::uniform_real_distribution<double> mant( -1, 1 );
+    std::uniform_int_distribution<int> expo( -20, 20 );
+
+    std::vector<Pnl> v( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v[i] = Pnl( std::ldexp( mant( rng ), expo( rng ) ) );
+
+    wv::span<Pnl const> const a = wv::make_span( v );
+
+    std::cout << "threads  plain  compensated  reproducible  (ns/element)  plain bits  compensated bits  reproducible bits" << std::endl;
+    std::cout << std::hex;
+
+    unsigned const threads[] = { 1, 2, 3, 4, 8 };
+
+    for ( std::size_t k = 0; k < sizeof threads / sizeof threads[0]; ++k )
+    {
+        Clock::time_point t0 = Clock::now();
+        Pnl const plain = wv::reduce( a, Pnl(), threads[k] );
+        double const t_plain = ns_per( t0, n );
+
+        t0 = Clock::now();
+        Pnl const comp = wv::compensated_sum( a, threads[k] );
+        double const t_comp = ns_per( t0, n );
+
+        t0 = Clock::now();
+        Pnl const repro = wv::reproducible_sum( a, threads[k] );
+        double const t_repro = ns_per( t0, n );
+
+        std::cout << std::dec << threads[k] << "\t" << t_plain << "\t" << t_comp << "\t" << t_repro << "\t" << std::hex
+                  << bits_of( plain ) << "\t" << bits_of( comp ) << "\t" << bits_of( repro ) << std::endl;
+    }
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,118 @@
+/*
+ * TestPerformanceTsc.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * Timestamps from the time stamp counter: the cost of a read with
+ * steady_clock::now(), tsc_clock::now() and now_ordered() and of a
+ * conversion with to_time(), and the accuracy of the calibrated clock
+ * against steady_clock over intervals from a millisecond to a second.
+ *
+ * Usage: TestPerformanceTsc [reads]
+ */
+
+#include "whole_value_tsc.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+typedef wv::tsc_clock::stamp Stamp;
+
+double ns_per( Clock::time_point const t0, std::size_t const n )
+{
+    return std::chrono::duration<double, std::nano>( Clock::now() - t0 ).count() / n;
+}
+
+/**
+ * reads of steady_clock and of the clock c with now() and now_ordered(), and conversions.
+ */
+void run_reads( wv::tsc_clock const & c, std::size_t const n )
+{
+    int64_t check = 0;
+
+    Clock::time_point t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        check += Clock::now().time_since_epoch().count() & 1;
+    double const steady = ns_per( t0, n );
+
+    uint64_t sum = 0;
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        sum += c.now().value();
+    double const now = ns_per( t0, n );
+
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        sum += c.now_ordered().value();
+    double const ordered = ns_per( t0, n );
+
+    std::vector<Stamp> stamps( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        stamps[i] = c.now();
+
+    std::vector<wv::tsc_clock::time_point> times( n );
+    t0 = Clock::now();
+    for ( std::size_t i = 0; i < n; ++i )
+        times[i] = c.to_time( stamps[i] );
+    double const convert = ns_per( t0, n );
+    check += times[ n / 2 ].value() & 1;
+
+    std::cout << ( c.uses_tsc() ? "tsc     " : "fallback" ) << ":\t" << steady << "\t\t" << now << "\t" << ordered << "\t\t" << convert
+        << ( ( check + int64_t( sum & 1 ) ) == -1 ? "\t(never)" : "" ) << std::endl;
+}
+
+/**
+ * elapsed time of the clock c against steady_clock, over interval.
+ */
+void run_accuracy( wv::tsc_clock const & c, std::chrono::milliseconds const interval )
+{
+    Clock::time_point const t0 = Clock::now();
+    Stamp const s0 = c.now_ordered();
+    std::this_thread::sleep_for( interval );
+    Stamp const s1 = c.now_ordered();
+    Clock::time_point const t1 = Clock::now();
+
+    int64_t const steady = std::chrono::duration_cast<std::chrono::nanoseconds>( t1 - t0 ).count();
+    int64_t const tsc = c.to_nanoseconds( s1 - s0 ).value();
+    int64_t const drift = ( c.to_time( s1 ).value() - std::chrono::duration_cast<std::chrono::nanoseconds>( t1.time_since_epoch() ).count() );
+
+    std::cout << interval.count() << " ms:\t" << steady << "\t" << tsc << "\t" << tsc - steady << "\t" << 1e6 * double( tsc - steady ) / double( steady ) << "\t" << drift << std::endl;
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], 0, 10 ) : 10000000;
+
+    wv::tsc_clock const c = wv::tsc_clock::calibrate();
+
+    std::cout << "Performance test of whole_value tsc: " << n << " reads, invariant TSC: " << ( wv::tsc_clock::invariant() ? "yes" : "no" )
+        << ", " << 4294967296.0 / double( c.scale() ) << " ticks/ns." << std::endl;
+    std::cout << "          steady_clock  now()  now_ordered()  to_time()  (ns/read)" << std::endl;
+
+    run_reads( c, n );
+    run_reads( wv::tsc_clock(), n );
+
+    std::cout << std::endl << "interval  steady ns  tsc ns  difference  ppm  to_time() - steady (ns)" << std::endl;
+
+    run_accuracy( c, std::chrono::milliseconds( 1 ) );
+    run_accuracy( c, std::chrono::milliseconds( 10 ) );
+    run_accuracy( c, std::chrono::milliseconds( 100 ) );
+    run_accuracy( c, std::chrono::milliseconds( 1000 ) );
+
+    return 0;
+}
+
+/*
+ * end of file
+ */
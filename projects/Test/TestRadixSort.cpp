@@ -0,0 +1,169 @@
+/*
+ * TestRadixSort.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_radix_sort.h"
+
+#include <algorithm>
+#include <random>
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+WV_DEFINE_QUANTITY_TYPE( FQuant, float )
+WV_DEFINE_ARITHMETIC_TYPE( Int64, int64_t )
+WV_DEFINE_ARITHMETIC_TYPE( UInt16, uint16_t )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Price, Quant )
+
+namespace {
+
+template< typename Q >
+bool is_sorted( std::vector<Q> const & v )
+{
+    for ( std::size_t i = 1; i < v.size(); ++i )
+        if ( v[i].value() < v[i-1].value() )
+            return false;
+    return true;
+}
+
+template< typename Q, typename T >
+std::vector<Q> make( std::vector<T> const & raw )
+{
+    return std::vector<Q>( raw.begin(), raw.end() );
+}
+}
+
+/* ----------------------------------------------------------------------------
+ * radix_sort:
+ */
+
+TEST_CASE( "radix_sort/key",
+           "Keys order like the values." )
+{
+    typedef wv::radix_key<double> D;
+    typedef wv::radix_key<int32_t> I;
+
+    REQUIRE( D::to_key( -2.0 ) < D::to_key( -1.0 ) );
+    REQUIRE( D::to_key( -1.0 ) < D::to_key( 0.0 ) );
+    REQUIRE( D::to_key( 0.0 ) < D::to_key( 1.5 ) );
+    REQUIRE( D::from_key( D::to_key( -3.25 ) ) == -3.25 );
+
+    REQUIRE( I::to_key( -1 ) < I::to_key( 0 ) );
+    REQUIRE( I::from_key( I::to_key( -77 ) ) == -77 );
+}
+
+TEST_CASE( "radix_sort/double",
+           "Sort quantities of double, including negative values." )
+{
+    std::mt19937_64 rng( 1 );
+    std::uniform_real_distribution<double> dist( -1e6, 1e6 );
+
+    std::vector<double> raw( 100000 );
+    for ( std::size_t i = 0; i < raw.size(); ++i )
+        raw[i] = dist( rng );
+
+    std::vector<Price> v = make<Price>( raw );
+    wv::radix_sort( v );
+
+    std::sort( raw.begin(), raw.end() );
+    REQUIRE( is_sorted( v ) );
+    for ( std::size_t i = 0; i < raw.size(); ++i )
+        REQUIRE( v[i].value() == raw[i] );
+}
+
+TEST_CASE( "radix_sort/integers",
+           "Sort signed and narrow unsigned integers." )
+{
+    std::mt19937_64 rng( 2 );
+
+    SECTION( "radix_sort/integers/int64", "" )
+    {
+        std::vector<Int64> v( 50000 );
+        for ( std::size_t i = 0; i < v.size(); ++i )
+            v[i] = Int64( int64_t( rng() ) );
+        wv::radix_sort( v );
+        REQUIRE( is_sorted( v ) );
+    }
+
+    SECTION( "radix_sort/integers/uint16", "" )
+    {
+        std::vector<UInt16> v( 50000 );
+        for ( std::size_t i = 0; i < v.size(); ++i )
+            v[i] = UInt16( uint16_t( rng() ) );
+        wv::radix_sort( v );
+        REQUIRE( is_sorted( v ) );
+    }
+
+    SECTION( "radix_sort/integers/float", "" )
+    {
+        std::vector<FQuant> v( 50000 );
+        for ( std::size_t i = 0; i < v.size(); ++i )
+            v[i] = FQuant( float( int64_t( rng() % 20001 ) - 10000 ) / 8 );
+        wv::radix_sort( v );
+        REQUIRE( is_sorted( v ) );
+    }
+}
+
+TEST_CASE( "radix_sort/parallel",
+           "Parallel sort gives the sequential result." )
+{
+    std::mt19937_64 rng( 3 );
+
+    std::vector<Int64> a( 300000 );
+    for ( std::size_t i = 0; i < a.size(); ++i )
+        a[i] = Int64( int64_t( rng() % 1000000 ) - 500000 );
+
+    std::vector<Int64> b( a );
+
+    wv::radix_sort( a, 1 );
+    wv::radix_sort( b, 4 );
+
+    REQUIRE( is_sorted( b ) );
+    for ( std::size_t i = 0; i < a.size(); ++i )
+        REQUIRE( a[i].value() == b[i].value() );
+}
+
+TEST_CASE( "radix_sort/by_key",
+           "Key-value sort is stable and permutes the values." )
+{
+    std::mt19937 rng( 4 );
+
+    std::vector<Int64> keys( 100000 );
+    std::vector<int> vals( keys.size() );
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        keys[i] = Int64( int64_t( rng() % 100 ) - 50 );
+        vals[i] = int( i );
+    }
+
+    std::vector<Int64> const orig( keys );
+
+    wv::radix_sort_by_key( keys, vals, 2 );
+
+    REQUIRE( is_sorted( keys ) );
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        REQUIRE( orig[ vals[i] ].value() == keys[i].value() );
+        if ( i > 0 && keys[i].value() == keys[i-1].value() )
+            REQUIRE( vals[i] > vals[i-1] );
+    }
+}
+
+/*
+ * end of file
+ */
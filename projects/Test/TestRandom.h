@@ -0,0 +1,45 @@
+/*
+ * TestRandom.h
+ * reproducible pseudo-random numbers for the tests and benchmarks.
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef G_WV_TEST_RANDOM_H_INCLUDED
+#define G_WV_TEST_RANDOM_H_INCLUDED
+
+#include <stdint.h>
+
+/**
+ * Marsaglia's xorshift64 generator: the same sequence on every platform and
+ * standard library, unlike the distributions of <random>.
+ */
+class xorshift64
+{
+public:
+    explicit xorshift64( uint64_t const seed = 88172645463325252ull ) : m_state( seed ) {}
+
+    /**
+     * next value of the sequence.
+     */
+    uint64_t operator()()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return m_state;
+    }
+
+private:
+    uint64_t m_state;
+};
+
+#endif // G_WV_TEST_RANDOM_H_INCLUDED
+
+/*
+ * end of file
+ */
@@ -0,0 +1,220 @@
+/*
+ * TestSaturating.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_saturating.h"
+
+#include <limits>
+#include <stdint.h>
+#include <vector>
+
+// Define fundamental value types:
+WV_DEFINE_SATURATING_ARITHMETIC_TYPE( Gain, int32_t )
+WV_DEFINE_SATURATING_ARITHMETIC_TYPE( Level, uint16_t )
+WV_DEFINE_SATURATING_QUANTITY_TYPE( Sample, int16_t )
+WV_DEFINE_SATURATING_QUANTITY_TYPE( Tokens, uint32_t )
+WV_DEFINE_QUANTITY_TYPE( Pixel, uint8_t )
+WV_DEFINE_QUANTITY_TYPE( Delta, int8_t )
+WV_DEFINE_QUANTITY_TYPE( Rate, int64_t )
+WV_DEFINE_BITS_TYPE( Flags, uint8_t )
+WV_DEFINE_BITS_TYPE( Mask, uint32_t )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Left, Sample )
+
+namespace {
+
+int32_t const int_max = std::numeric_limits<int32_t>::max();
+int32_t const int_min = std::numeric_limits<int32_t>::min();
+
+template< typename T >
+T clamp( long long const x )
+{
+    return x > std::numeric_limits<T>::max() ? std::numeric_limits<T>::max()
+         : x < std::numeric_limits<T>::min() ? std::numeric_limits<T>::min() : T( x );
+}
+
+/**
+ * compare the bulk kernels with the scalar operations for n elements.
+ */
+template< typename Q >
+bool bulk_matches( std::size_t const n )
+{
+    typedef typename Q::value_type T;
+
+    std::vector<Q> a( n ), b( n ), sum( n ), difference( n );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        a[i] = Q( T( i * 2654435761u ) );
+        b[i] = Q( T( i * 40503u + 17 ) );
+    }
+
+    wv::saturating_add( wv::make_span( a ), wv::make_span( b ), wv::make_span( sum ) );
+    wv::saturating_sub( wv::make_span( a ), wv::make_span( b ), wv::make_span( difference ) );
+
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        if ( sum[i].value() != clamp<T>( (long long)a[i].value() + b[i].value() ) )
+            return false;
+        if ( difference[i].value() != clamp<T>( (long long)a[i].value() - b[i].value() ) )
+            return false;
+    }
+    return true;
+}
+}
+
+/* ----------------------------------------------------------------------------
+ * saturating_arithmetic and saturating_quantity:
+ */
+
+TEST_CASE( "saturating/arithmetic",
+           "Results that do not fit clamp to the limits." )
+{
+    REQUIRE( ( Gain( 7 ) + Gain( 3 ) ).value() == 10 );
+    REQUIRE( ( Gain( int_max ) + Gain( 1 ) ).value() == int_max );
+    REQUIRE( ( Gain( int_min ) - Gain( 1 ) ).value() == int_min );
+    REQUIRE( ( Gain( int_min ) + Gain( int_min ) ).value() == int_min );
+    REQUIRE( ( Gain( 1 ) - Gain( int_min ) ).value() == int_max );
+    REQUIRE( ( Gain( 65536 ) * Gain( 65536 ) ).value() == int_max );
+    REQUIRE( ( Gain( -65536 ) * Gain( 65536 ) ).value() == int_min );
+    REQUIRE( ( Gain( int_min ) / Gain( -1 ) ).value() == int_max );
+    REQUIRE( ( Gain( int_min ) % Gain( -1 ) ).value() == 0 );
+    REQUIRE( ( Gain( 5 ) / Gain( 0 ) ).value() == int_max );
+    REQUIRE( ( Gain( -5 ) / Gain( 0 ) ).value() == int_min );
+    REQUIRE( ( Gain( 0 ) / Gain( 0 ) ).value() == 0 );
+    REQUIRE( ( -Gain( int_min ) ).value() == int_max );
+    REQUIRE( wv::abs( Gain( int_min ) ).value() == int_max );
+
+    Gain g( int_max );
+    REQUIRE( ( ++g ).value() == int_max );
+    REQUIRE( g.unchecked().value() == int_max );
+
+    Level l( 0 );
+    REQUIRE( ( --l ).value() == 0 );
+    REQUIRE( ( Level( 1 ) - Level( 2 ) ).value() == 0 );
+    REQUIRE( ( Level( 65000 ) + Level( 1000 ) ).value() == 65535 );
+    REQUIRE( ( Level( 300 ) * Level( 300 ) ).value() == 65535 );
+    REQUIRE( ( Level( 3 ) / Level( 0 ) ).value() == 65535 );
+}
+
+TEST_CASE( "saturating/exhaustive",
+           "All 8-bit operand pairs match clamping the exact result." )
+{
+    typedef wv::detail::saturate<int8_t> s8;
+    typedef wv::detail::saturate<uint8_t> u8;
+
+    for ( int a = -128; a < 128; ++a )
+    {
+        for ( int b = -128; b < 128; ++b )
+        {
+            REQUIRE( s8::add( int8_t( a ), int8_t( b ) ) == clamp<int8_t>( a + b ) );
+            REQUIRE( s8::sub( int8_t( a ), int8_t( b ) ) == clamp<int8_t>( a - b ) );
+            REQUIRE( s8::mul( int8_t( a ), int8_t( b ) ) == clamp<int8_t>( a * b ) );
+            if ( b != 0 )
+                REQUIRE( s8::div( int8_t( a ), int8_t( b ) ) == clamp<int8_t>( a / b ) );
+
+            int const x = a + 128, y = b + 128;
+            REQUIRE( u8::add( uint8_t( x ), uint8_t( y ) ) == clamp<uint8_t>( x + y ) );
+            REQUIRE( u8::sub( uint8_t( x ), uint8_t( y ) ) == clamp<uint8_t>( x - y ) );
+            REQUIRE( u8::mul( uint8_t( x ), uint8_t( y ) ) == clamp<uint8_t>( x * y ) );
+        }
+    }
+}
+
+TEST_CASE( "saturating/quantity",
+           "Quantity addition and scaling saturate; sub types keep saturating." )
+{
+    REQUIRE( ( Sample( 30000 ) + Sample( 30000 ) ).value() == 32767 );
+    REQUIRE( ( Sample( -30000 ) - Sample( 30000 ) ).value() == -32768 );
+    REQUIRE( ( Sample( 20000 ) * 2 ).value() == 32767 );
+    REQUIRE( ( -2 * Sample( 20000 ) ).value() == -32768 );
+    REQUIRE( ( Sample( 15 ) / 4 ).value() == 3 );
+
+    Left const l( 30000 );
+    REQUIRE( ( l + l ).value() == 32767 );
+
+    Tokens t( 5 );
+    t -= Tokens( 7 );
+    REQUIRE( t.value() == 0 );
+    t += Tokens( 4000000000u );
+    t += Tokens( 4000000000u );
+    REQUIRE( t.value() == 4294967295u );
+}
+
+/* ----------------------------------------------------------------------------
+ * bits shifts:
+ */
+
+TEST_CASE( "saturating/shift",
+           "A left shift that loses a set bit gives all ones; large shifts are defined." )
+{
+    REQUIRE( wv::saturating_shl( Flags( 0x21 ), 2 ) == Flags( 0x84 ) );
+    REQUIRE( wv::saturating_shl( Flags( 0x21 ), 3 ) == Flags( 0xff ) );
+    REQUIRE( wv::saturating_shl( Flags( 0x01 ), 7 ) == Flags( 0x80 ) );
+    REQUIRE( wv::saturating_shl( Flags( 0x01 ), 8 ) == Flags( 0xff ) );
+    REQUIRE( wv::saturating_shl( Flags( 0x00 ), 100 ) == Flags( 0x00 ) );
+    REQUIRE( wv::saturating_shl( Flags( 0x80 ), 0 ) == Flags( 0x80 ) );
+
+    REQUIRE( wv::saturating_shl( Mask( 0xffffu ), 16 ) == Mask( 0xffff0000u ) );
+    REQUIRE( wv::saturating_shl( Mask( 0x1ffffu ), 16 ) == Mask( 0xffffffffu ) );
+    REQUIRE( wv::saturating_shl( Mask( 1 ), 32 ) == Mask( 0xffffffffu ) );
+
+    REQUIRE( wv::saturating_shr( Flags( 0x84 ), 2 ) == Flags( 0x21 ) );
+    REQUIRE( wv::saturating_shr( Flags( 0xff ), 8 ) == Flags( 0x00 ) );
+    REQUIRE( wv::saturating_shr( Mask( 0xffffffffu ), 31 ) == Mask( 1 ) );
+    REQUIRE( wv::saturating_shr( Mask( 0xffffffffu ), 40 ) == Mask( 0 ) );
+}
+
+/* ----------------------------------------------------------------------------
+ * bulk kernels:
+ */
+
+TEST_CASE( "saturating/bulk",
+           "Bulk add and subtract match the scalar operations for all widths and sizes." )
+{
+    std::size_t const sizes[] = { 0, 1, 7, 15, 16, 17, 33, 1000 };
+
+    for ( std::size_t k = 0; k < sizeof( sizes ) / sizeof( sizes[0] ); ++k )
+    {
+        std::size_t const n = sizes[k];
+        REQUIRE( bulk_matches<Pixel>( n ) );
+        REQUIRE( bulk_matches<Delta>( n ) );
+        REQUIRE( bulk_matches<Sample>( n ) );
+        REQUIRE( bulk_matches<Level>( n ) );
+        REQUIRE( bulk_matches<Gain>( n ) );
+        REQUIRE( bulk_matches<Tokens>( n ) );
+        REQUIRE( bulk_matches<Rate>( n ) );
+    }
+}
+
+TEST_CASE( "saturating/bulk-in-place",
+           "The output may be one of the inputs." )
+{
+    std::vector<Pixel> a( 40, Pixel( 200 ) );
+    std::vector<Pixel> const b( 40, Pixel( 100 ) );
+
+    wv::saturating_add( wv::make_span( a ), wv::make_span( b ), wv::make_span( a ) );
+    REQUIRE( a[0].value() == 255 );
+    REQUIRE( a[39].value() == 255 );
+
+    wv::saturating_sub( wv::make_span( b ), wv::make_span( a ), wv::make_span( a ) );
+    REQUIRE( a[0].value() == 0 );
+    REQUIRE( a[39].value() == 0 );
+}
+
+/*
+ * end of file
+ */
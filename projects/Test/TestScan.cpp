@@ -0,0 +1,153 @@
+/*
+ * TestScan.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_scan.h"
+
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_ARITHMETIC_TYPE( Count, int64_t )
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Volume, Count )
+
+namespace {
+
+std::vector<Count> counts( std::size_t const n )
+{
+    std::vector<Count> v( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v[i] = Count( int64_t( i % 7 ) - 2 );
+    return v;
+}
+
+struct maximum
+{
+    Count operator()( Count const & x, Count const & y ) const { return x < y ? y : x; }
+};
+}
+
+/* ----------------------------------------------------------------------------
+ * reduce:
+ */
+
+TEST_CASE( "scan/reduce",
+           "Reduce sequentially and in parallel; the result has the whole value type." )
+{
+    std::vector<Count> const v = counts( 100000 );
+
+    int64_t expected = 10;
+    for ( std::size_t i = 0; i < v.size(); ++i )
+        expected += v[i].value();
+
+    Count const s1 = wv::reduce( wv::make_span( v ), Count( 10 ) );
+    Count const s4 = wv::reduce( wv::make_span( v ), Count( 10 ), 4 );
+    Count const m4 = wv::reduce( wv::make_span( v ), Count( -100 ), maximum(), 4 );
+
+    REQUIRE( s1.value() == expected );
+    REQUIRE( s4.value() == expected );
+    REQUIRE( m4.value() == 4 );
+    REQUIRE( wv::reduce( wv::span<Count const>() ).value() == 0 );
+}
+
+TEST_CASE( "scan/reduce-subtype",
+           "A sub type reduces to the sub type." )
+{
+    std::vector<Volume> v( 3, Volume( 5 ) );
+
+    Volume const s = wv::reduce( wv::make_span( v ) );
+
+    REQUIRE( s.value() == 15 );
+}
+
+/* ----------------------------------------------------------------------------
+ * scans:
+ */
+
+TEST_CASE( "scan/inclusive",
+           "Parallel inclusive scan gives the sequential result, also in place." )
+{
+    std::size_t const sizes[] = { 0, 1, 5, 16384, 16385, 100000 };
+
+    for ( std::size_t s = 0; s < sizeof sizes / sizeof sizes[0]; ++s )
+    {
+        std::vector<Count> const v = counts( sizes[s] );
+        std::vector<Count> a( v.size() ), b( v.size() ), c( v );
+
+        wv::inclusive_scan( wv::make_span( v ), wv::make_span( a ) );
+        wv::inclusive_scan( wv::make_span( v ), wv::make_span( b ), 3 );
+        wv::inclusive_scan( wv::make_span( c ), wv::make_span( c ), 4 );
+
+        int64_t acc = 0;
+        for ( std::size_t i = 0; i < v.size(); ++i )
+        {
+            acc += v[i].value();
+            REQUIRE( a[i].value() == acc );
+            REQUIRE( b[i].value() == acc );
+            REQUIRE( c[i].value() == acc );
+        }
+    }
+}
+
+TEST_CASE( "scan/exclusive",
+           "Parallel exclusive scan with initial value gives the sequential result, also in place." )
+{
+    std::vector<Count> const v = counts( 70000 );
+    std::vector<Count> a( v.size() ), b( v );
+
+    wv::exclusive_scan( wv::make_span( v ), wv::make_span( a ), Count( 100 ) );
+    wv::exclusive_scan( wv::make_span( b ), wv::make_span( b ), Count( 100 ), 4 );
+
+    int64_t acc = 100;
+    for ( std::size_t i = 0; i < v.size(); ++i )
+    {
+        REQUIRE( a[i].value() == acc );
+        REQUIRE( b[i].value() == acc );
+        acc += v[i].value();
+    }
+}
+
+TEST_CASE( "scan/operation",
+           "Scan with a user operation." )
+{
+    std::vector<Count> const v = counts( 50000 );
+    std::vector<Count> a( v.size() );
+
+    wv::inclusive_scan( wv::make_span( v ), wv::make_span( a ), Count( -100 ), maximum(), 2 );
+
+    REQUIRE( a[0].value() == -2 );
+    REQUIRE( a[1].value() == -1 );
+    REQUIRE( a[6].value() == 4 );
+    REQUIRE( a.back().value() == 4 );
+}
+
+TEST_CASE( "scan/quantity",
+           "Scan of a quantity yields the quantity." )
+{
+    std::vector<Quant> v( 1000, Quant( 0.5 ) );
+    std::vector<Quant> a( v.size() );
+
+    wv::inclusive_scan( wv::make_span( v ), wv::make_span( a ) );
+
+    REQUIRE( a.back().value() == 500.0 );
+    REQUIRE( wv::reduce( wv::make_span( v ) ).value() == 500.0 );
+}
+
+/*
+ * end of file
+ */
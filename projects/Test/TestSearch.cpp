@@ -0,0 +1,138 @@
+/*
+ * TestSearch.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_search.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+WV_DEFINE_VALUE_TYPE( Id, int )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Price, Quant )
+
+namespace {
+
+/**
+ * sorted ids in [0, range), with duplicates when n > range.
+ */
+std::vector<Id> sorted_ids( std::size_t const n, int const range, unsigned const seed )
+{
+    std::mt19937 rng( seed );
+    std::vector<int> raw( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        raw[i] = int( rng() % unsigned( range ) );
+    std::sort( raw.begin(), raw.end() );
+    return std::vector<Id>( raw.begin(), raw.end() );
+}
+
+std::size_t std_lower_bound( std::vector<Id> const & v, int const key )
+{
+    std::vector<int> raw;
+    for ( std::size_t i = 0; i < v.size(); ++i )
+        raw.push_back( v[i].value() );
+    return std::lower_bound( raw.begin(), raw.end(), key ) - raw.begin();
+}
+}
+
+/* ----------------------------------------------------------------------------
+ * search:
+ */
+
+TEST_CASE( "search/agree",
+           "All searches agree with std::lower_bound, also for keys outside the range and duplicates." )
+{
+    std::size_t const sizes[] = { 0, 1, 2, 3, 7, 8, 15, 16, 17, 63, 64, 65, 100, 1000, 4097 };
+
+    for ( std::size_t s = 0; s < sizeof sizes / sizeof sizes[0]; ++s )
+    {
+        std::vector<Id> const v = sorted_ids( sizes[s], 200, unsigned( s ) );
+        wv::eytzinger<Id> const tree( wv::make_span( v ) );
+
+        REQUIRE( tree.size() == v.size() );
+
+        for ( int key = -2; key <= 202; ++key )
+        {
+            std::size_t const expected = std_lower_bound( v, key );
+
+            REQUIRE( wv::branchless_lower_bound( v, Id( key ) ) == expected );
+            REQUIRE( wv::linear_lower_bound( v, Id( key ) ) == expected );
+            REQUIRE( wv::lower_bound( v, Id( key ) ) == expected );
+            REQUIRE( tree.lower_bound( Id( key ) ) == expected );
+        }
+    }
+}
+
+TEST_CASE( "search/not-found",
+           "A key above all elements yields size()." )
+{
+    std::vector<Price> v;
+    for ( int i = 0; i < 100; ++i )
+        v.push_back( Price( 0.5 * i ) );
+
+    wv::eytzinger<Price> const tree( wv::make_span( v ) );
+
+    REQUIRE( tree.lower_bound( Price( 49.5 ) ) == 99u );
+    REQUIRE( tree.lower_bound( Price( 49.6 ) ) == 100u );
+    REQUIRE( wv::lower_bound( v, Price( 1e9 ) ) == 100u );
+    REQUIRE( wv::lower_bound( v, Price( -1e9 ) ) == 0u );
+    REQUIRE( wv::eytzinger<Price>().lower_bound( Price( 1 ) ) == 0u );
+}
+
+TEST_CASE( "search/eytzinger-copy",
+           "A copied, moved or assigned tree searches like the original." )
+{
+    REQUIRE( wv::eytzinger<Price>::line_values == 8u );
+    REQUIRE( wv::eytzinger<Id>::line_values == 16u );
+
+    std::vector<Id> const v = sorted_ids( 1000, 5000, 7 );
+    wv::eytzinger<Id> const tree( wv::make_span( v ) );
+
+    wv::eytzinger<Id> copy( tree );
+    wv::eytzinger<Id> assigned;
+    assigned = copy;
+    wv::eytzinger<Id> const moved( std::move( copy ) );
+
+    for ( int key = -1; key <= 5001; key += 3 )
+    {
+        std::size_t const expected = std_lower_bound( v, key );
+
+        REQUIRE( assigned.lower_bound( Id( key ) ) == expected );
+        REQUIRE( moved.lower_bound( Id( key ) ) == expected );
+    }
+}
+
+TEST_CASE( "search/span",
+           "Search a subspan of non-const values." )
+{
+    std::vector<Price> v;
+    for ( int i = 0; i < 10; ++i )
+        v.push_back( Price( i ) );
+
+    wv::span<Price const> const tail = wv::span<Price const>( wv::make_span( v ) ).subspan( 5, 5 );
+
+    REQUIRE( wv::lower_bound( tail, Price( 7 ) ) == 2u );
+    REQUIRE( wv::branchless_lower_bound( tail, Price( 0 ) ) == 0u );
+    REQUIRE( wv::linear_lower_bound( tail, Price( 10 ) ) == 5u );
+}
+
+/*
+ * end of file
+ */
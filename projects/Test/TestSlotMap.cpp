@@ -0,0 +1,155 @@
+/*
+ * TestSlotMap.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_slot_map.h"
+
+#include <stdexcept>
+#include <stdint.h>
+#include <string>
+
+// Define fundamental value types:
+WV_DEFINE_VALUE_TYPE( EntityId, uint32_t )
+WV_DEFINE_QUANTITY_TYPE( Mass, double )
+
+typedef wv::slot_map< EntityId, Mass > Entities;
+
+/* ----------------------------------------------------------------------------
+ * slot_map:
+ */
+
+TEST_CASE( "slot_map/handle",
+           "Handle packs index and generation." )
+{
+    REQUIRE( Entities::index_mask == 0x00ffffffu );
+    REQUIRE( Entities::generation_mask == 0xffu );
+
+    Entities m;
+    EntityId h = m.insert( Mass( 1 ) );
+    REQUIRE( Entities::index_of( h ) == 0u );
+    REQUIRE( Entities::generation_of( h ) == 1u );
+
+    REQUIRE( !m.contains( EntityId() ) );
+}
+
+TEST_CASE( "slot_map/insert-find",
+           "Insert and look up." )
+{
+    Entities m;
+    EntityId a = m.insert( Mass( 1 ) );
+    EntityId b = m.insert( Mass( 2 ) );
+    EntityId c = m.emplace( 3.0 );
+
+    REQUIRE( m.size() == 3 );
+    REQUIRE( m[a].value() == 1 );
+    REQUIRE( m[b].value() == 2 );
+    REQUIRE( m.find( c )->value() == 3 );
+    REQUIRE( m.at( c ).value() == 3 );
+}
+
+TEST_CASE( "slot_map/erase",
+           "Erase detects stale handles and keeps values dense." )
+{
+    Entities m;
+    EntityId a = m.insert( Mass( 1 ) );
+    EntityId b = m.insert( Mass( 2 ) );
+    EntityId c = m.insert( Mass( 3 ) );
+
+    REQUIRE( m.erase( a ) );
+    REQUIRE( !m.erase( a ) );
+
+    REQUIRE( !m.contains( a ) );
+    REQUIRE( m.find( a ) == 0 );
+    REQUIRE_THROWS_AS( m.at( a ), std::out_of_range );
+
+    REQUIRE( m.size() == 2 );
+    REQUIRE( m[b].value() == 2 );
+    REQUIRE( m[c].value() == 3 );
+
+    SECTION( "slot_map/erase/reuse", "A reused slot gets a new generation." )
+    {
+        EntityId d = m.insert( Mass( 4 ) );
+        REQUIRE( Entities::index_of( d ) == Entities::index_of( a ) );
+        REQUIRE( Entities::generation_of( d ) != Entities::generation_of( a ) );
+        REQUIRE( !m.contains( a ) );
+        REQUIRE( m[d].value() == 4 );
+    }
+
+    SECTION( "slot_map/erase/dense", "Values stay contiguous." )
+    {
+        double sum = 0;
+        for ( Entities::iterator it = m.begin(); it != m.end(); ++it )
+            sum += it->value();
+        REQUIRE( sum == 5 );
+        REQUIRE( m.values().size() == 2 );
+
+        for ( std::size_t i = 0; i < m.size(); ++i )
+            REQUIRE( m[ m.handle_at( i ) ].value() == m.values()[i].value() );
+    }
+}
+
+TEST_CASE( "slot_map/clear",
+           "Clear invalidates all handles." )
+{
+    wv::slot_map< EntityId, std::string > m;
+    EntityId a = m.insert( "a" );
+    EntityId b = m.insert( "b" );
+    m.clear();
+    REQUIRE( m.empty() );
+    REQUIRE( !m.contains( a ) );
+    REQUIRE( !m.contains( b ) );
+    REQUIRE( *m.find( m.insert( "c" ) ) == "c" );
+}
+
+namespace {
+
+    /**
+     * value whose constructor throws for a negative argument.
+     */
+    struct Checked
+    {
+        explicit Checked( int const x ) : value( x ) { if ( x < 0 ) throw std::invalid_argument( "negative" ); }
+        int value;
+    };
+}
+
+TEST_CASE( "slot_map/emplace-throws",
+           "A throwing value constructor leaves the map unchanged and the slot free." )
+{
+    wv::slot_map< EntityId, Checked > m;
+    EntityId const a = m.emplace( 1 );
+
+    REQUIRE_THROWS_AS( m.emplace( -1 ), std::invalid_argument );
+    REQUIRE( m.size() == 1 );
+    REQUIRE( m.at( a ).value == 1 );
+
+    // the slot taken for the failed element is used again:
+    EntityId const b = m.emplace( 2 );
+    REQUIRE( wv::slot_map< EntityId, Checked >::index_of( b ) == 1u );
+    REQUIRE( m.size() == 2 );
+    REQUIRE( m.at( b ).value == 2 );
+
+    m.erase( a );
+    REQUIRE_THROWS_AS( m.emplace( -2 ), std::invalid_argument );
+    EntityId const c = m.emplace( 3 );
+    REQUIRE( wv::slot_map< EntityId, Checked >::index_of( c ) == 0u );
+    REQUIRE( !m.contains( a ) );
+    REQUIRE( m.at( c ).value == 3 );
+}
+
+/*
+ * end of file
+ */
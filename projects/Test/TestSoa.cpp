@@ -0,0 +1,238 @@
+/*
+ * TestSoa.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_soa.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Price, double )
+WV_DEFINE_QUANTITY_TYPE( Volume, int )
+WV_DEFINE_VALUE_TYPE( OrderId, unsigned )
+
+typedef wv::soa< OrderId, Price, Volume > Book;
+
+namespace {
+
+Book make_book( int n )
+{
+    Book book;
+    for ( int i = 0; i < n; ++i )
+        book.push_back( OrderId( i ), Price( 100 + i ), Volume( 10 * i ) );
+    return book;
+}
+
+// field whose copy throws on request:
+struct Fragile
+{
+    explicit Fragile( bool fail ) : fail( fail ) {}
+
+    Fragile( Fragile const & other ) : fail( other.fail )
+    {
+        if ( fail )
+            throw std::runtime_error( "Fragile: copy failed" );
+    }
+
+    bool fail;
+};
+}
+
+/* ----------------------------------------------------------------------------
+ * span:
+ */
+
+TEST_CASE( "span/values",
+           "Span of whole values viewed as span of underlying values." )
+{
+    std::vector<Price> v( 3, Price( 1.5 ) );
+
+    wv::span<Price> s = wv::make_span( v );
+    wv::span<double> d = wv::values( s );
+
+    REQUIRE( d.size() == 3 );
+    d[1] = 2.5;
+    REQUIRE( v[1].value() == 2.5 );
+
+    wv::span<Price const> c = s;
+    REQUIRE( wv::values( c )[1] == 2.5 );
+    REQUIRE( wv::as_whole_values<Price>( d )[1].value() == 2.5 );
+}
+
+/* ----------------------------------------------------------------------------
+ * soa:
+ */
+
+TEST_CASE( "soa/construction",
+           "Structure-of-arrays construction." )
+{
+    SECTION( "soa/construction/default", "" )
+    {
+        Book book;
+        REQUIRE( book.empty() );
+        REQUIRE( book.size() == 0 );
+    }
+
+    SECTION( "soa/construction/size", "" )
+    {
+        Book book( 5 );
+        REQUIRE( book.size() == 5 );
+        REQUIRE( book[4].get<Volume>().value() == 0 );
+    }
+}
+
+TEST_CASE( "soa/row",
+           "Row proxy reads and writes like the record." )
+{
+    Book book = make_book( 4 );
+
+    REQUIRE( book[2].get<OrderId>().value() == 2u );
+    REQUIRE( book[2].get<Price>().value() == 102 );
+    REQUIRE( wv::get<Volume>( book[2] ).value() == 20 );
+    REQUIRE( book[2].get<1>().value() == 102 );
+
+    book[2].get<Price>() = Price( 99 );
+    REQUIRE( book.column<Price>()[2].value() == 99 );
+
+    book.push_back( std::make_tuple( OrderId( 7 ), Price( 7 ), Volume( 7 ) ) );
+    REQUIRE( book.back().get<OrderId>().value() == 7u );
+
+    Book const & cbook = book;
+    REQUIRE( cbook[0].get<Price>().value() == 100 );
+}
+
+TEST_CASE( "soa/column",
+           "Columns are contiguous spans." )
+{
+    Book book = make_book( 100 );
+
+    wv::span<Volume const> vol = static_cast<Book const &>( book ).column<Volume>();
+    REQUIRE( vol.size() == 100 );
+    REQUIRE( &vol[1] == &vol[0] + 1 );
+
+    long sum = 0;
+    wv::span<int const> raw = wv::values( vol );
+    for ( std::size_t i = 0; i < raw.size(); ++i )
+        sum += raw[i];
+    REQUIRE( sum == 10 * 99 * 100 / 2 );
+}
+
+TEST_CASE( "soa/modify",
+           "Reserve, erase and iteration." )
+{
+    SECTION( "soa/modify/reserve", "" )
+    {
+        Book book;
+        book.reserve( 1000 );
+        REQUIRE( book.capacity() >= 1000 );
+        REQUIRE( book.column<Price>().size() == 0 );
+    }
+
+    SECTION( "soa/modify/erase", "Erase keeps order." )
+    {
+        Book book = make_book( 5 );
+        book.erase( 1 );
+        REQUIRE( book.size() == 4 );
+        REQUIRE( book[1].get<OrderId>().value() == 2u );
+        REQUIRE( book[1].get<Price>().value() == 102 );
+        REQUIRE( book[3].get<Volume>().value() == 40 );
+    }
+
+    SECTION( "soa/modify/erase_unordered", "Erase moves the last row in." )
+    {
+        Book book = make_book( 5 );
+        book.erase_unordered( 1 );
+        REQUIRE( book.size() == 4 );
+        REQUIRE( book[1].get<OrderId>().value() == 4u );
+        REQUIRE( book[1].get<Volume>().value() == 40 );
+    }
+
+    SECTION( "soa/modify/push_back-throws", "A throwing field leaves all columns as they were." )
+    {
+        wv::soa< OrderId, Fragile, Volume > fragile;
+        fragile.push_back( OrderId( 1 ), Fragile( false ), Volume( 10 ) );
+
+        REQUIRE_THROWS_AS( fragile.push_back( OrderId( 2 ), Fragile( true ), Volume( 20 ) ), std::runtime_error );
+        REQUIRE( fragile.size() == 1 );
+        REQUIRE( fragile.column<OrderId>().size() == 1 );
+        REQUIRE( fragile.column<Fragile>().size() == 1 );
+        REQUIRE( fragile.column<Volume>().size() == 1 );
+        REQUIRE( fragile[0].get<OrderId>().value() == 1u );
+
+        fragile.push_back( OrderId( 3 ), Fragile( false ), Volume( 30 ) );
+        REQUIRE( fragile.size() == 2 );
+        REQUIRE( fragile[1].get<Volume>().value() == 30 );
+    }
+
+    SECTION( "soa/modify/iterate", "" )
+    {
+        Book book = make_book( 10 );
+        double sum = 0;
+        for ( Book::iterator it = book.begin(); it != book.end(); ++it )
+            sum += ( *it ).get<Price>().value();
+        REQUIRE( sum == 1045 );
+        REQUIRE( book.end() - book.begin() == 10 );
+    }
+}
+
+TEST_CASE( "soa/iterator",
+           "Iterators are random access and work with reading algorithms." )
+{
+    Book book = make_book( 10 );
+    Book const & cbook = book;
+
+    Book::iterator const first = book.begin();
+    Book::iterator const last = book.end();
+
+    REQUIRE( 3 + first == first + 3 );
+    REQUIRE( ( first + 3 )->get<Volume>().value() == 30 );
+    REQUIRE( first[3].get<OrderId>().value() == 3u );
+    REQUIRE( last > first );
+    REQUIRE( first <= first );
+    REQUIRE( last >= first + 10 );
+    REQUIRE( !( first > last ) );
+
+    Book::const_iterator c = first;
+    REQUIRE( c == cbook.begin() );
+    REQUIRE( cbook.end() - c == 10 );
+    REQUIRE( last != c );
+
+    Book::const_reference const row = *first;
+    REQUIRE( row.get<Price>().value() == 100 );
+
+    REQUIRE( std::distance( first, last ) == 10 );
+
+    Book::const_iterator const it = std::lower_bound( cbook.begin(), cbook.end(), Price( 104.5 ),
+        []( Book::const_reference r, Price const & p ) { return r.get<Price>() < p; } );
+    REQUIRE( it - cbook.begin() == 5 );
+
+    Book::iterator const found = std::find_if( first, last,
+        []( Book::reference r ) { return r.get<Volume>() == Volume( 70 ); } );
+    REQUIRE( found->get<OrderId>().value() == 7u );
+
+    std::reverse_iterator<Book::iterator> const r( last );
+    REQUIRE( r->get<OrderId>().value() == 9u );
+
+    REQUIRE( ( std::is_same< std::iterator_traits<Book::iterator>::iterator_category, std::random_access_iterator_tag >::value ) );
+    REQUIRE( !( std::is_copy_assignable< Book::reference >::value ) );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,118 @@
+/*
+ * TestSum.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_sum.h"
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdint.h>
+
+// Define fundamental value types:
+WV_DEFINE_QUANTITY_TYPE( Quant, double )
+WV_DEFINE_QUANTITY_TYPE( FQuant, float )
+
+// Define 'domain' value types:
+WV_DEFINE_TYPE( Pnl, Quant )
+
+namespace {
+
+uint64_t bits_of( double const x )
+{
+    uint64_t u;
+    std::memcpy( &u, &x, sizeof u );
+    return u;
+}
+
+/**
+ * values of widely different magnitude and sign, so the sum depends on the order.
+ */
+std::vector<Pnl> ill_conditioned( std::size_t const n, double const scale )
+{
+    std::mt19937_64 rng( 11 );
+    std::uniform_real_distribution<double> mant( -1, 1 );
+    std::uniform_int_distribution<int> expo( -30, 30 );
+
+    std::vector<Pnl> v( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v[i] = Pnl( scale * std::ldexp( mant( rng ), expo( rng ) ) );
+    return v;
+}
+}
+
+/* ----------------------------------------------------------------------------
+ * reproducible_sum:
+ */
+
+TEST_CASE( "sum/reproducible-threads",
+           "The reproducible sum has the same bits for every thread count." )
+{
+    std::vector<Pnl> const v = ill_conditioned( 200000, 1.0 );
+    wv::span<Pnl const> const a = wv::make_span( v );
+
+    uint64_t const one = bits_of( wv::reproducible_sum( a, 1 ).value() );
+
+    for ( unsigned threads = 2; threads <= 9; ++threads )
+        REQUIRE( bits_of( wv::reproducible_sum( a, threads ).value() ) == one );
+}
+
+TEST_CASE( "sum/reproducible-accuracy",
+           "The reproducible sum is close to the compensated sum, and exact where a plain sum is not." )
+{
+    std::vector<Pnl> const v = ill_conditioned( 100000, 1.0 );
+    wv::span<Pnl const> const a = wv::make_span( v );
+
+    double const r = wv::reproducible_sum( a ).value();
+    double const c = wv::compensated_sum( a ).value();
+
+    REQUIRE( std::fabs( r - c ) <= 1e-6 );
+
+    std::vector<Quant> w;
+    w.push_back( Quant( 1e16 ) );
+    w.push_back( Quant( 1.0 ) );
+    w.push_back( Quant( -1e16 ) );
+    w.push_back( Quant( 1.0 ) );
+
+    REQUIRE( wv::reproducible_sum( wv::make_span( w ) ).value() == 2.0 );
+    REQUIRE( wv::compensated_sum( wv::make_span( w ) ).value() == 2.0 );
+}
+
+TEST_CASE( "sum/reproducible-range",
+           "Sums of empty, tiny, huge, infinite and float spans." )
+{
+    REQUIRE( wv::reproducible_sum( wv::span<Quant const>() ).value() == 0.0 );
+
+    std::vector<Pnl> const tiny = ill_conditioned( 50000, 1e-290 );
+    std::vector<Pnl> const huge = ill_conditioned( 50000, 1e296 );
+
+    REQUIRE( bits_of( wv::reproducible_sum( wv::make_span( tiny ), 1 ).value() ) ==
+             bits_of( wv::reproducible_sum( wv::make_span( tiny ), 3 ).value() ) );
+    REQUIRE( bits_of( wv::reproducible_sum( wv::make_span( huge ), 1 ).value() ) ==
+             bits_of( wv::reproducible_sum( wv::make_span( huge ), 3 ).value() ) );
+    REQUIRE( std::fabs( wv::reproducible_sum( wv::make_span( huge ) ).value() / wv::compensated_sum( wv::make_span( huge ) ).value() - 1 ) < 1e-12 );
+
+    std::vector<Quant> inf( 3, Quant( 1.0 ) );
+    inf[1] = Quant( std::numeric_limits<double>::infinity() );
+    REQUIRE( wv::reproducible_sum( wv::make_span( inf ) ).value() == std::numeric_limits<double>::infinity() );
+
+    std::vector<FQuant> f( 1000, FQuant( 0.1f ) );
+    REQUIRE( std::fabs( wv::reproducible_sum( wv::make_span( f ) ).value() - 1000 * 0.1f ) < 1e-3 );
+}
+
+/*
+ * end of file
+ */
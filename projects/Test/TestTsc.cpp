@@ -0,0 +1,98 @@
+/*
+ * TestTsc.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_chrono.h"
+#include "whole_value_tsc.h"
+
+#include <chrono>
+#include <stdint.h>
+#include <thread>
+
+typedef wv::tsc_clock::ticks Ticks;
+typedef wv::tsc_clock::stamp Stamp;
+typedef wv::tsc_clock::nanoseconds Nanos;
+typedef wv::tsc_clock::time_point Time;
+
+TEST_CASE( "tsc/scale",
+           "Ticks convert to nanoseconds with the calibrated fixed-point scale." )
+{
+    // 3 GHz: a second of ticks after 1000 ticks and 500 ns:
+    wv::tsc_clock const c( Stamp( 1000 ), Time( 500 ), Stamp( 1000 + 3000000000ull ), Time( 500 + 1000000000 ) );
+
+    REQUIRE( c.uses_tsc() );
+    REQUIRE( c.scale() == 1431655765u );
+
+    REQUIRE( c.to_nanoseconds( Ticks( 0 ) ) == Nanos( 0 ) );
+    REQUIRE( c.to_nanoseconds( Ticks( 3 ) ).value() == 0 );
+    REQUIRE( c.to_nanoseconds( Ticks( 3000 ) ).value() == 999 );
+    REQUIRE( c.to_nanoseconds( Ticks( 3000000000ull ) ).value() >= 999999999 );
+    REQUIRE( c.to_nanoseconds( Ticks( 3000000000ull ) ).value() <= 1000000000 );
+
+    // a day of ticks, beyond 32 bits of nanoseconds:
+    int64_t const day = c.to_nanoseconds( Ticks( 3000000000ull * 86400 ) ).value();
+    REQUIRE( day > 86400000000000ll - 100000 );
+    REQUIRE( day <= 86400000000000ll );
+
+    REQUIRE( c.to_time( Stamp( 1000 + 3000000000ull ) ) == Time( 500 + 1000000000 ) );
+    REQUIRE( c.to_time( Stamp( 1000 ) ).value() >= 500 );
+    REQUIRE( c.to_time( Stamp( 1000 ) ).value() <= 501 );
+    REQUIRE( c.to_time( Stamp( 1000 + 3000000000ull - 3000 ) ).value() == 500 + 1000000000 - 999 );
+    REQUIRE( c.to_time( Stamp( 1000 + 3000000000ull + 3000 ) ).value() == 500 + 1000000000 + 999 );
+}
+
+TEST_CASE( "tsc/fallback",
+           "The fallback clock reads steady nanoseconds." )
+{
+    wv::tsc_clock const c;
+
+    REQUIRE( !c.uses_tsc() );
+    REQUIRE( c.to_nanoseconds( Ticks( 123456789012ull ) ) == Nanos( 123456789012ll ) );
+    REQUIRE( c.to_time( Stamp( 42 ) ) == Time( 42 ) );
+
+    Stamp const s = c.now();
+    std::chrono::steady_clock::time_point const t = std::chrono::steady_clock::now();
+    REQUIRE( c.now_ordered() >= s );
+    REQUIRE( wv::to_time_point( c.to_time( s ) ) <= t );
+    REQUIRE( t - wv::to_time_point( c.to_time( s ) ) < std::chrono::seconds( 1 ) );
+}
+
+TEST_CASE( "tsc/calibrate",
+           "The calibrated clock measures time like steady_clock." )
+{
+    wv::tsc_clock const c = wv::tsc_clock::calibrate( std::chrono::milliseconds( 5 ) );
+
+    REQUIRE( c.uses_tsc() == wv::tsc_clock::invariant() );
+
+    std::chrono::steady_clock::time_point const t0 = std::chrono::steady_clock::now();
+    Stamp const s0 = c.now_ordered();
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    Stamp const s1 = c.now_ordered();
+    std::chrono::steady_clock::time_point const t1 = std::chrono::steady_clock::now();
+
+    REQUIRE( s1 > s0 );
+
+    Nanos const elapsed = c.to_nanoseconds( s1 - s0 );
+    REQUIRE( elapsed >= Nanos( 19000000 ) );
+    REQUIRE( wv::to_duration( elapsed ) <= t1 - t0 + std::chrono::milliseconds( 1 ) );
+
+    REQUIRE( wv::to_time_point( c.to_time( s0 ) ) >= t0 - std::chrono::milliseconds( 1 ) );
+    REQUIRE( wv::to_time_point( c.to_time( s1 ) ) <= t1 + std::chrono::milliseconds( 1 ) );
+}
+
+/*
+ * end of file
+ */
@@ -0,0 +1,132 @@
+/*
+ * TestUnit.cpp
+ *
+ * Created by Martin on 18 October 2026.
+ * Copyright 2026 Universiteit Leiden. All rights reserved.
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See accompanying
+ * file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+/*
+ * These tests use the Catch test framework by Phil Nash.
+ * - https://github.com/philsquared/Catch - MSVC8, 9, 2010, GCC 4.2, LLVM 4.0
+ */
+
+#include "catch.hpp"
+
+#include "whole_value_unit.h"
+
+#include <ratio>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+// Define families and fundamental value types:
+struct Time {};
+struct Data {};
+
+typedef std::ratio<1024> kibi;
+typedef std::ratio<1048576> mebi;
+
+WV_DEFINE_SCALED_TYPE( Nanoseconds, int64_t, Time, std::nano )
+WV_DEFINE_SCALED_TYPE( Milliseconds, int64_t, Time, std::milli )
+WV_DEFINE_SCALED_TYPE( Seconds, int64_t, Time, std::ratio<1> )
+WV_DEFINE_SCALED_TYPE( Minutes, int32_t, Time, std::ratio<60> )
+WV_DEFINE_SCALED_TYPE( SecondsReal, double, Time, std::ratio<1> )
+
+WV_DEFINE_SCALED_TYPE( Bytes, uint64_t, Data, std::ratio<1> )
+WV_DEFINE_SCALED_TYPE( KiB, uint64_t, Data, kibi )
+WV_DEFINE_SCALED_TYPE( MiB, double, Data, mebi )
+
+TEST_CASE( "unit/conversion",
+           "Conversions are implicit where lossless, explicit with unit_cast otherwise." )
+{
+    REQUIRE( ( std::is_convertible< Seconds, Milliseconds >::value ) );
+    REQUIRE( ( std::is_convertible< Minutes, Seconds >::value ) );
+    REQUIRE( ( std::is_convertible< Milliseconds, SecondsReal >::value ) );
+    REQUIRE( ( std::is_convertible< KiB, Bytes >::value ) );
+    REQUIRE( !( std::is_convertible< Milliseconds, Seconds >::value ) );
+    REQUIRE( !( std::is_convertible< Seconds, Minutes >::value ) );
+    REQUIRE( !( std::is_convertible< SecondsReal, Seconds >::value ) );
+    REQUIRE( !( std::is_convertible< Bytes, KiB >::value ) );
+    REQUIRE( !( std::is_convertible< Bytes, Seconds >::value ) );
+
+    Milliseconds const ms = Seconds( 3 );
+    REQUIRE( ms.value() == 3000 );
+
+    Nanoseconds const ns = Minutes( 2 );
+    REQUIRE( ns.value() == 120000000000ll );
+
+    SecondsReal const s = Milliseconds( 1500 );
+    REQUIRE( s.value() == 1.5 );
+
+    Bytes const b = KiB( 4 );
+    REQUIRE( b.value() == 4096 );
+
+    MiB const m = KiB( 512 );
+    REQUIRE( m.value() == 0.5 );
+
+    REQUIRE( wv::unit_cast<Seconds>( Milliseconds( 2999 ) ).value() == 2 );
+    REQUIRE( wv::unit_cast<Seconds>( Milliseconds( -2999 ) ).value() == -2 );
+    REQUIRE( wv::unit_cast<Minutes>( Seconds( 150 ) ).value() == 2 );
+    REQUIRE( wv::unit_cast<Seconds>( SecondsReal( 2.75 ) ).value() == 2 );
+    REQUIRE( wv::unit_cast<KiB>( Bytes( 5000 ) ).value() == 4 );
+    REQUIRE( wv::unit_cast<Milliseconds>( Seconds( 7 ) ).value() == 7000 );
+}
+
+TEST_CASE( "unit/operators",
+           "Mixed units add, subtract and compare in the common unit." )
+{
+    REQUIRE( ( std::is_same< decltype( Seconds() + Milliseconds() ), Milliseconds >::value ) );
+    REQUIRE( ( std::is_same< decltype( Seconds() - Seconds() ), Seconds >::value ) );
+
+    REQUIRE( ( Seconds( 2 ) + Milliseconds( 250 ) ).value() == 2250 );
+    REQUIRE( ( Milliseconds( 250 ) - Seconds( 1 ) ).value() == -750 );
+    REQUIRE( ( Seconds( 2 ) + Seconds( 3 ) ).value() == 5 );
+
+    REQUIRE( Seconds( 1 ) == Milliseconds( 1000 ) );
+    REQUIRE( Seconds( 1 ) != Milliseconds( 1001 ) );
+    REQUIRE( Seconds( 1 ) < Milliseconds( 1001 ) );
+    REQUIRE( Minutes( 1 ) > Seconds( 59 ) );
+    REQUIRE( KiB( 1 ) == Bytes( 1024 ) );
+
+    REQUIRE( ( std::is_same< decltype( Minutes() + Milliseconds() ), Milliseconds >::value ) );
+    REQUIRE( ( std::is_same< decltype( Minutes() + SecondsReal() ), SecondsReal >::value ) );
+    REQUIRE( ( Minutes( 1 ) + Milliseconds( 500 ) ).value() == 60500 );
+
+    Seconds s( 10 );
+    s += Seconds( 5 );
+    REQUIRE( ( s * 2 ).value() == 30 );
+}
+
+TEST_CASE( "unit/bulk",
+           "convert() converts a span of quantities to another unit." )
+{
+    std::size_t const n = 1001;
+
+    std::vector<Milliseconds> ms( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        ms[i] = Milliseconds( int64_t( i ) * 997 - 500000 );
+
+    std::vector<Nanoseconds> ns( n );
+    std::vector<Seconds> s( n );
+    std::vector<SecondsReal> r( n );
+
+    wv::convert( wv::make_span( ms ), wv::make_span( ns ) );
+    wv::convert( wv::make_span( ms ), wv::make_span( s ) );
+    wv::convert( wv::make_span( ms ), wv::make_span( r ) );
+
+    bool same = true;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+        same = same && ns[i].value() == ms[i].value() * 1000000;
+        same = same && s[i].value() == ms[i].value() / 1000;
+        same = same && r[i].value() == double( ms[i].value() ) * 0.001;
+    }
+    REQUIRE( same );
+}
+
+/*
+ * end of file
+ */
@@ -12,6 +12,12 @@ set BO=-DWV_USE_BOOST_OPERATORS
 
 g++ -Wall -Wextra --pedantic %BO% -I../../../include/ -I%BOOST_INCLUDE% -I%CATCH_INCLUDE% -o Test ../../Test/TestMain.cpp ../../Test/TestArithmetic.cpp ../../Test/TestBits.cpp ../../Test/TestQuantity.cpp ../../Test/TestSafeBool.cpp ../../Test/TestWholeValue.cpp && Test
 
+:: extension headers, C++11:
+
+set EXT=../../Test/TestColumn.cpp ../../Test/TestSoa.cpp ../../Test/TestIndexVector.cpp ../../Test/TestSlotMap.cpp ../../Test/TestHash.cpp ../../Test/TestFlatMap.cpp ../../Test/TestRadixSort.cpp ../../Test/TestSearch.cpp ../../Test/TestFilter.cpp ../../Test/TestScan.cpp ../../Test/TestSum.cpp ../../Test/TestAccumulate.cpp ../../Test/TestChecked.cpp ../../Test/TestSaturating.cpp ../../Test/TestFixed.cpp ../../Test/TestDecimal.cpp ../../Test/TestModular.cpp ../../Test/TestDivide.cpp ../../Test/TestDimension.cpp ../../Test/TestUnit.cpp ../../Test/TestAffine.cpp ../../Test/TestChrono.cpp ../../Test/TestTsc.cpp ../../Test/TestOptional.cpp ../../Test/TestBounded.cpp ../../Test/TestPacked.cpp
+
+g++ -std=c++11 -pthread -Wall -Wextra --pedantic -I../../../include/ -I%CATCH_INCLUDE% -o TestExt ../../Test/TestMain.cpp %EXT% && TestExt
+
 goto :EOF
 
 :BOOST_ERROR
@@ -7,9 +7,39 @@
 
 call :Compile TestPerformance-Contained.exe      -O2  &&^
 call :Compile TestPerformance-Contained.exe      -O2 -DWV_DEFINE_OPERATORS_IN_TERMS_OF_A_MINIMAL_NUMBER_OF_FUNDAMENTAL_OPERATORS &&^
-call :Compile TestPerformance-BoostOperators.exe -O2 -DWV_USE_BOOST_OPERATORS
+call :Compile TestPerformance-BoostOperators.exe -O2 -DWV_USE_BOOST_OPERATORS &&^
+call :Benchmark TestPerformanceColumn &&^
+call :Benchmark TestPerformanceSlotMap &&^
+call :Benchmark TestPerformanceHash &&^
+call :Benchmark TestPerformanceRadixSort &&^
+call :Benchmark TestPerformanceSearch -O3 &&^
+call :Benchmark TestPerformanceFilter &&^
+call :Benchmark TestPerformanceScan &&^
+call :Benchmark TestPerformanceSum &&^
+call :Benchmark TestPerformanceAccumulate &&^
+call :Benchmark TestPerformanceChecked &&^
+call :Benchmark TestPerformanceSaturating &&^
+call :Benchmark TestPerformanceFixed &&^
+call :Benchmark TestPerformanceDecimal &&^
+call :Benchmark TestPerformanceModular &&^
+call :Benchmark TestPerformanceDivide &&^
+call :Benchmark TestPerformanceDimension &&^
+call :Benchmark TestPerformanceTsc &&^
+call :Benchmark TestPerformanceOptional &&^
+call :Benchmark TestPerformancePacked
 goto :EOF
 
+:Benchmark
+setlocal
+set NAME=%1
+set OPT=%2
+if "%OPT%"=="" set OPT=-O2
+g++ -std=c++11 -pthread %OPT% -march=native -Wall -Wextra --pedantic -I../../../include/ -o %NAME% ../../Test/%NAME%.cpp &&^
+echo. &&^
+%NAME%
+echo.
+endlocal & goto :EOF
+
 :Compile
 setlocal
 set NAME=%1